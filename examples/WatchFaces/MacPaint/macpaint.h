@@ -1,513 +1,339 @@
+// Generated by tools/assetgen.py from assets.json, do not edit. 4755 bytes of PROGMEM
 // 'colon', 11x31px
 const unsigned char colon [] PROGMEM = {
-	0x00, 0x00, 0x07, 0x00, 0x0f, 0xc0, 0x1f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x1f, 0xc0, 
-	0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x80, 0x3f, 0x80, 
+	0x00, 0x00, 0x07, 0x00, 0x0f, 0xc0, 0x1f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x1f, 0xc0,
+	0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x80, 0x3f, 0x80,
 	0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x3f, 0x80, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00
 };
-// 'h0', 38x50px
+// 'numbers0', 38x50px
 const unsigned char numbers0 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 
-	0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 
-	0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0x00, 
-	0x01, 0xff, 0x81, 0xf0, 0x00, 0x01, 0xff, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x03, 0xfc, 0x00, 0x03, 
-	0xfc, 0x03, 0xfe, 0x00, 0x03, 0xf8, 0x01, 0xfe, 0x00, 0x07, 0xf8, 0x00, 0xfe, 0x00, 0x07, 0xf0, 
-	0x00, 0xff, 0x00, 0x07, 0xf0, 0x00, 0xff, 0x00, 0x07, 0xf0, 0x00, 0x7f, 0x00, 0x07, 0xf8, 0x00, 
-	0x7f, 0x00, 0x07, 0xfc, 0x00, 0x7f, 0x00, 0x03, 0xfc, 0x00, 0x7f, 0x00, 0x01, 0xfc, 0x00, 0xff, 
-	0x00, 0x01, 0xfc, 0x00, 0xfe, 0x00, 0x01, 0xfe, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 
-	0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 
-	0x1f, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc,
+	0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00,
+	0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xe0, 0x00,
+	0x01, 0xff, 0x81, 0xf0, 0x00, 0x01, 0xff, 0x03, 0xf8, 0x00, 0x01, 0xfe, 0x03, 0xfc, 0x00, 0x03,
+	0xfc, 0x03, 0xfe, 0x00, 0x03, 0xf8, 0x01, 0xfe, 0x00, 0x07, 0xf8, 0x00, 0xfe, 0x00, 0x07, 0xf0,
+	0x00, 0xff, 0x00, 0x07, 0xf0, 0x00, 0xff, 0x00, 0x07, 0xf0, 0x00, 0x7f, 0x00, 0x07, 0xf8, 0x00,
+	0x7f, 0x00, 0x07, 0xfc, 0x00, 0x7f, 0x00, 0x03, 0xfc, 0x00, 0x7f, 0x00, 0x01, 0xfc, 0x00, 0xff,
+	0x00, 0x01, 0xfc, 0x00, 0xfe, 0x00, 0x01, 0xfe, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00,
+	0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00,
+	0x1f, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h1', 38x50px
+// 'numbers1', 38x50px
 const unsigned char numbers1 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 
-	0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 
-	0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 
-	0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x80, 0x00, 0x00, 0x0e, 0x3f, 0x80, 0x00, 
-	0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 
-	0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 
-	0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 
-	0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 
-	0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 
-	0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 
-	0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 
-	0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 
-	0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 
-	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01,
+	0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff,
+	0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00,
+	0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x80, 0x00, 0x00, 0x0e, 0x3f, 0x80, 0x00,
+	0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00,
+	0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00,
+	0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f,
+	0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80,
+	0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00,
+	0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00,
+	0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
 	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h2', 38x50px
+// 'numbers2', 38x50px
 const unsigned char numbers2 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x3f, 
-	0xff, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 
-	0xe0, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xfe, 0x3f, 0xf8, 0x00, 0x07, 0xfc, 0x07, 0xf8, 
-	0x00, 0x07, 0xf8, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x03, 0xfc, 0x00, 
-	0x07, 0xf0, 0x01, 0xfc, 0x00, 0x07, 0xf0, 0x01, 0xfc, 0x00, 0x07, 0xf0, 0x03, 0xfc, 0x00, 0x07, 
-	0xf8, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x03, 0xf8, 0x07, 0xf0, 0x00, 0x01, 0xf0, 
-	0x0f, 0xf0, 0x00, 0x00, 0xe0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x3f, 
-	0xc0, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0x00, 
-	0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 
-	0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x01, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0x00, 0x01, 0xc0, 0x0f, 0xfe, 
-	0x00, 0x03, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 
-	0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 
-	0x80, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x3f,
+	0xff, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff,
+	0xe0, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xfe, 0x3f, 0xf8, 0x00, 0x07, 0xfc, 0x07, 0xf8,
+	0x00, 0x07, 0xf8, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x03, 0xfc, 0x00,
+	0x07, 0xf0, 0x01, 0xfc, 0x00, 0x07, 0xf0, 0x01, 0xfc, 0x00, 0x07, 0xf0, 0x03, 0xfc, 0x00, 0x07,
+	0xf8, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x03, 0xf8, 0x07, 0xf0, 0x00, 0x01, 0xf0,
+	0x0f, 0xf0, 0x00, 0x00, 0xe0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x3f,
+	0xc0, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0x00,
+	0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00,
+	0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x01,
+	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0x00, 0x01, 0xc0, 0x0f, 0xfe,
+	0x00, 0x03, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
+	0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff,
+	0x80, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h3', 38x50px
+// 'numbers3', 38x50px
 const unsigned char numbers3 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x03, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x7f, 
-	0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 
-	0xff, 0x00, 0x01, 0xff, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x7f, 0x80, 0x01, 0xfc, 0x00, 0x3f, 
-	0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 
-	0x01, 0xfc, 0x00, 0x7f, 0xc0, 0x00, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 
-	0x0f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x3f, 
-	0xf0, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x03, 0x80, 0x0f, 0xfe, 
-	0x00, 0x07, 0xc0, 0x07, 0xff, 0x00, 0x0f, 0xe0, 0x00, 0xff, 0x00, 0x1f, 0xe0, 0x00, 0x7f, 0x00, 
-	0x1f, 0xe0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f, 
-	0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xf0, 0x00, 0x7f, 0x00, 0x1f, 0xf8, 
-	0x00, 0xff, 0x00, 0x1f, 0xfc, 0x07, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 
-	0xfc, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xe0, 
-	0x00, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x7f,
+	0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0xff, 0x01, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x7f, 0x80, 0x01, 0xfc, 0x00, 0x3f,
+	0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x3f, 0xc0,
+	0x01, 0xfc, 0x00, 0x7f, 0xc0, 0x00, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0x70, 0x00, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00,
+	0x0f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x3f,
+	0xf0, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x03, 0x80, 0x0f, 0xfe,
+	0x00, 0x07, 0xc0, 0x07, 0xff, 0x00, 0x0f, 0xe0, 0x00, 0xff, 0x00, 0x1f, 0xe0, 0x00, 0x7f, 0x00,
+	0x1f, 0xe0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f,
+	0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xc0, 0x00, 0x7f, 0x00, 0x1f, 0xf0, 0x00, 0x7f, 0x00, 0x1f, 0xf8,
+	0x00, 0xff, 0x00, 0x1f, 0xfc, 0x07, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff,
+	0xfc, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xe0,
+	0x00, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h4', 38x50px
+// 'numbers4', 38x50px
 const unsigned char numbers4 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x7f, 
-	0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 
-	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x70, 0x00, 0x00, 0x7f, 0x00, 0xf8, 
-	0x00, 0x00, 0x7f, 0x01, 0xfc, 0x00, 0x00, 0x7f, 0x01, 0xfc, 0x00, 0x00, 0xff, 0x01, 0xfc, 0x00, 
-	0x00, 0xff, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xfc, 0x00, 0x00, 
-	0xfe, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x80, 0x01, 0xfe, 
-	0x01, 0xff, 0xc0, 0x01, 0xfe, 0x0f, 0xff, 0xc0, 0x01, 0xfd, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 
-	0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 
-	0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xfc, 0xfe, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x00, 
-	0x00, 0x70, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 
-	0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 
-	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x70, 0x00, 0x00, 0x7f, 0x00, 0xf8,
+	0x00, 0x00, 0x7f, 0x01, 0xfc, 0x00, 0x00, 0x7f, 0x01, 0xfc, 0x00, 0x00, 0xff, 0x01, 0xfc, 0x00,
+	0x00, 0xff, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xfc, 0x00, 0x00,
+	0xfe, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x80, 0x01, 0xfe,
+	0x01, 0xff, 0xc0, 0x01, 0xfe, 0x0f, 0xff, 0xc0, 0x01, 0xfd, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff,
+	0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe,
+	0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xfc, 0xfe, 0x00, 0x00, 0xff, 0x80, 0xfe, 0x00,
+	0x00, 0x70, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h5', 38x50px
+// 'numbers5', 38x50px
 const unsigned char numbers5 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x07, 
-	0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 
-	0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xf0, 0x00, 
-	0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 
-	0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x7c, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0x00, 
-	0x07, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x07, 
-	0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xef, 0xff, 0x00, 0x07, 0xf0, 
-	0x00, 0xff, 0x80, 0x03, 0xe0, 0x00, 0x7f, 0x80, 0x01, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 
-	0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 
-	0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 
-	0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 
-	0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x0f, 
-	0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x1f, 0xff, 
-	0xc0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x07,
+	0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x0f, 0xff,
+	0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xf0, 0x00,
+	0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00,
+	0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x7c, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0x00,
+	0x07, 0xff, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x07,
+	0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xef, 0xff, 0x00, 0x07, 0xf0,
+	0x00, 0xff, 0x80, 0x03, 0xe0, 0x00, 0x7f, 0x80, 0x01, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00,
+	0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f,
+	0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80,
+	0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+	0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x0f,
+	0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x1f, 0xff,
+	0xc0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h6', 38x50px
+// 'numbers6', 38x50px
 const unsigned char numbers6 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
-	0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 
-	0xff, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xf8, 
-	0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 
-	0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 
-	0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x03, 
-	0xfe, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xf8, 0xfe, 0x00, 0x00, 0x07, 0xf9, 
-	0xff, 0x00, 0x00, 0x07, 0xf3, 0xff, 0x80, 0x00, 0x0f, 0xf3, 0xff, 0xc0, 0x00, 0x0f, 0xe3, 0xff, 
-	0xe0, 0x00, 0x0f, 0xe1, 0xff, 0xf0, 0x00, 0x1f, 0xe0, 0xff, 0xf8, 0x00, 0x1f, 0xe0, 0x07, 0xfc, 
-	0x00, 0x1f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 
-	0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 
-	0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xe0, 0x01, 0xfc, 0x00, 0x1f, 0xe0, 0x03, 0xfc, 0x00, 0x0f, 0xe0, 
-	0x1f, 0xf8, 0x00, 0x0f, 0xfc, 0x3f, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 
-	0xe0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0x00, 
-	0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01,
+	0xff, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xf8,
+	0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00,
+	0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00,
+	0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x03,
+	0xfe, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xf8, 0xfe, 0x00, 0x00, 0x07, 0xf9,
+	0xff, 0x00, 0x00, 0x07, 0xf3, 0xff, 0x80, 0x00, 0x0f, 0xf3, 0xff, 0xc0, 0x00, 0x0f, 0xe3, 0xff,
+	0xe0, 0x00, 0x0f, 0xe1, 0xff, 0xf0, 0x00, 0x1f, 0xe0, 0xff, 0xf8, 0x00, 0x1f, 0xe0, 0x07, 0xfc,
+	0x00, 0x1f, 0xc0, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00,
+	0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x1f,
+	0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xe0, 0x01, 0xfc, 0x00, 0x1f, 0xe0, 0x03, 0xfc, 0x00, 0x0f, 0xe0,
+	0x1f, 0xf8, 0x00, 0x0f, 0xfc, 0x3f, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff,
+	0xe0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h7', 38x50px
+// 'numbers7', 38x50px
 const unsigned char numbers7 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff, 
-	0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 
-	0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 
-	0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 
-	0x00, 0x03, 0xf8, 0x00, 0x00, 0x01, 0xc3, 0xf8, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x07, 
-	0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 
-	0xf8, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xfc, 
-	0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 
-	0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 
-	0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 
-	0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff,
+	0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff,
+	0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00,
+	0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00,
+	0x00, 0x03, 0xf8, 0x00, 0x00, 0x01, 0xc3, 0xf8, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x07,
+	0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff,
+	0xf8, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xfc,
+	0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00,
+	0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+	0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h8', 38x50px
+// 'numbers8', 38x50px
 const unsigned char numbers8 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 
-	0x3f, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 
-	0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0x8f, 0xf8, 0x00, 0x07, 0xf8, 0x03, 
-	0xf8, 0x00, 0x07, 0xf0, 0x03, 0xf8, 0x00, 0x0f, 0xf0, 0x03, 0xf8, 0x00, 0x0f, 0xf0, 0x03, 0xf8, 
-	0x00, 0x0f, 0xe0, 0x07, 0xf8, 0x00, 0x0f, 0xe0, 0x07, 0xf8, 0x00, 0x0f, 0xe0, 0x07, 0xf0, 0x00, 
-	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x0f, 0xf8, 0x1f, 0xf0, 0x00, 0x07, 0xff, 0xdf, 0xe0, 0x00, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x7f, 
-	0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xff, 
-	0xfc, 0x00, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xf9, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 
-	0x80, 0x00, 0x1f, 0xe0, 0x7f, 0xc0, 0x00, 0x1f, 0xe0, 0x3f, 0xe0, 0x00, 0x1f, 0xc0, 0x1f, 0xe0, 
-	0x00, 0x3f, 0xc0, 0x0f, 0xe0, 0x00, 0x3f, 0xc0, 0x0f, 0xf0, 0x00, 0x3f, 0x80, 0x0f, 0xf0, 0x00, 
-	0x7f, 0x80, 0x07, 0xf0, 0x00, 0x7f, 0x80, 0x0f, 0xf0, 0x00, 0x7f, 0x00, 0x0f, 0xf0, 0x00, 0x7f, 
-	0x80, 0x0f, 0xe0, 0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x00, 0x3f, 0xf0, 0x3f, 0xe0, 0x00, 0x3f, 0xff, 
-	0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xfe, 
-	0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00,
+	0x3f, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff,
+	0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0x8f, 0xf8, 0x00, 0x07, 0xf8, 0x03,
+	0xf8, 0x00, 0x07, 0xf0, 0x03, 0xf8, 0x00, 0x0f, 0xf0, 0x03, 0xf8, 0x00, 0x0f, 0xf0, 0x03, 0xf8,
+	0x00, 0x0f, 0xe0, 0x07, 0xf8, 0x00, 0x0f, 0xe0, 0x07, 0xf8, 0x00, 0x0f, 0xe0, 0x07, 0xf0, 0x00,
+	0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x0f, 0xf8, 0x1f, 0xf0, 0x00, 0x07, 0xff, 0xdf, 0xe0, 0x00, 0x03,
+	0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x7f,
+	0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xff,
+	0xfc, 0x00, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xf9, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+	0x80, 0x00, 0x1f, 0xe0, 0x7f, 0xc0, 0x00, 0x1f, 0xe0, 0x3f, 0xe0, 0x00, 0x1f, 0xc0, 0x1f, 0xe0,
+	0x00, 0x3f, 0xc0, 0x0f, 0xe0, 0x00, 0x3f, 0xc0, 0x0f, 0xf0, 0x00, 0x3f, 0x80, 0x0f, 0xf0, 0x00,
+	0x7f, 0x80, 0x07, 0xf0, 0x00, 0x7f, 0x80, 0x0f, 0xf0, 0x00, 0x7f, 0x00, 0x0f, 0xf0, 0x00, 0x7f,
+	0x80, 0x0f, 0xe0, 0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x00, 0x3f, 0xf0, 0x3f, 0xe0, 0x00, 0x3f, 0xff,
+	0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xfe,
+	0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'h9', 38x50px
+// 'numbers9', 38x50px
 const unsigned char numbers9 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 
-	0x03, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x7f, 
-	0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 
-	0xe0, 0x00, 0x03, 0xff, 0x1f, 0xe0, 0x00, 0x03, 0xf8, 0x0f, 0xe0, 0x00, 0x07, 0xf8, 0x0f, 0xe0, 
-	0x00, 0x07, 0xf8, 0x1f, 0xe0, 0x00, 0x07, 0xf0, 0x1f, 0xe0, 0x00, 0x07, 0xf0, 0x1f, 0xc0, 0x00, 
-	0x07, 0xf0, 0x3f, 0xc0, 0x00, 0x07, 0xf0, 0x7f, 0xc0, 0x00, 0x07, 0xf0, 0x7f, 0x80, 0x00, 0x07, 
-	0xf8, 0x7f, 0x00, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 
-	0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 
-	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 
-	0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-	0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 
-	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 
-	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00,
+	0x03, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x7f,
+	0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff,
+	0xe0, 0x00, 0x03, 0xff, 0x1f, 0xe0, 0x00, 0x03, 0xf8, 0x0f, 0xe0, 0x00, 0x07, 0xf8, 0x0f, 0xe0,
+	0x00, 0x07, 0xf8, 0x1f, 0xe0, 0x00, 0x07, 0xf0, 0x1f, 0xe0, 0x00, 0x07, 0xf0, 0x1f, 0xc0, 0x00,
+	0x07, 0xf0, 0x3f, 0xc0, 0x00, 0x07, 0xf0, 0x7f, 0xc0, 0x00, 0x07, 0xf0, 0x7f, 0x80, 0x00, 0x07,
+	0xf8, 0x7f, 0x00, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff,
+	0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'macpaint', 200x200px
-const unsigned char window [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x40, 0x00, 0x10, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00, 
-	0x8a, 0x40, 0x11, 0xc6, 0x01, 0x08, 0x46, 0x91, 0x00, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x96, 0xa0, 0x12, 0xb4, 0x01, 0x15, 0x5a, 
-	0xaa, 0x00, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x1f, 0x00, 0x9a, 0xe0, 0x12, 0x94, 0x01, 0x55, 0x55, 0xbb, 0x00, 0x8a, 0xa4, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x92, 0x80, 0x32, 0xd6, 0x01, 
-	0x55, 0x56, 0xa1, 0x80, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x88, 0x88, 0x10, 0x00, 0x04, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xaa, 0xaa, 0xa5, 0x52, 0x55, 0x55, 0x49, 0x24, 0x95, 
-	0x54, 0xa5, 0x55, 0x55, 0x55, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0xb5, 
-	0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0xbf, 0xde, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x40, 0x01, 0x00, 0x0d, 0x5f, 0x77, 
-	0x77, 0x7f, 0xff, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0x7d, 0xf7, 0x77, 0xdf, 0x77, 0x7d, 0xf7, 
-	0x77, 0xdd, 0x55, 0xc0, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x41, 0xe2, 0x36, 0x4d, 
-	0x4d, 0xbb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xbb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 
-	0x6d, 0xb6, 0xdb, 0x6d, 0x55, 0x84, 0x09, 0x00, 0x2d, 0x6a, 0x02, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xab, 0x48, 0x08, 
-	0x00, 0x06, 0xab, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x31, 0x20, 0x2d, 0x55, 0x05, 0x56, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xaa, 
-	0x4b, 0x80, 0x00, 0x0d, 0x6a, 0x05, 0x6a, 0xd5, 0x55, 0xb6, 0xdb, 0x55, 0xb6, 0xd5, 0xb6, 0xd6, 
-	0xdb, 0x6d, 0x6d, 0xb6, 0xdb, 0x5b, 0x6d, 0x69, 0x55, 0xc4, 0x02, 0x00, 0x0a, 0xab, 0x7a, 0xaa, 
-	0xad, 0xb6, 0xaa, 0xaa, 0xb6, 0xaa, 0xad, 0x55, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xad, 0xab, 0x42, 0x01, 0x2a, 0xcd, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x84, 0x00, 0x00, 0x0d, 0x75, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0xaa, 0x40, 0x02, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xf7, 0x7b, 0xff, 
-	0xfd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 
-	0x82, 0x04, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x85, 0x60, 0x06, 0x0d, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x41, 0x29, 0x0a, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xc6, 0x28, 0x0b, 0x0d, 0x20, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x4a, 0x02, 0x11, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x84, 0x11, 0x1d, 0x85, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x10, 0x20, 0x8d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x82, 0x22, 
-	0x20, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x61, 0xa5, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0xd5, 0x53, 0x14, 0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x0a, 0x82, 0x2d, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x81, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0x82, 0x20, 0x05, 0x20, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0xc2, 0x81, 0x16, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xa0, 0x05, 
-	0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x44, 0x9a, 0x0b, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 
-	0x18, 0x0a, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x32, 0x0b, 0x0d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc4, 0x59, 0x09, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x42, 0x90, 0x0b, 0x0d, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x80, 0x01, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x7f, 0xff, 0x7b, 0xfd, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0xfe, 0x00, 0x06, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7f, 0x7e, 
-	0x03, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0x3e, 0x00, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x7f, 0x7e, 0x07, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0x3e, 0x01, 0x0d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x7d, 0x5e, 0x0a, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xfc, 0x9e, 0x12, 0x05, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x7f, 0xfe, 0x14, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xfc, 0x9e, 0x18, 
-	0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7a, 0x5e, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 
-	0xff, 0x52, 0x4d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x02, 0x09, 0x2d, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x80, 0x01, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00, 0x03, 0x85, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x88, 0x02, 0x04, 0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x46, 0x01, 0x08, 0xcd, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xc1, 0x82, 0x11, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x60, 
-	0x2b, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x12, 0x26, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x01, 0x34, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x00, 0x00, 0x06, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x40, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0xfb, 0xfb, 0xed, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 
-	0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x4d, 0xb1, 0x3e, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 
-	0x08, 0x22, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x48, 0x09, 0x35, 0x45, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc8, 0x08, 0x2a, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x48, 0x0a, 0x2a, 0xad, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x8a, 0xa8, 0x3f, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x52, 0xa9, 
-	0x22, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc8, 0x45, 0x49, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x47, 0xf1, 0x1f, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x08, 0x2a, 0x4d, 0x60, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x48, 0x09, 0x35, 0xad, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc8, 0x08, 0x2a, 
-	0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x02, 0x2a, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x87, 
-	0x61, 0x1d, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x80, 0x02, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7f, 0xff, 0xf7, 0xf5, 0xa0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x80, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 
-	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xc2, 0xc0, 0x0d, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x44, 0x32, 
-	0x15, 0xcd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x08, 0x2a, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x48, 0x09, 0x35, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x10, 0x35, 0x4d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x46, 0xb2, 0x1f, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc0, 0x01, 0x00, 0x06, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x82, 0x93, 0x00, 
-	0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x69, 0x4a, 0xb6, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 
-	0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x02, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc7, 0x31, 0x19, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x48, 0x88, 0x2e, 0xc5, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x88, 0x09, 0x32, 0x4d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x10, 0x2a, 0xcd, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x84, 0x22, 0x15, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x41, 0x81, 
-	0x0e, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc0, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x02, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x7f, 0xfb, 0xf7, 0xb5, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x02, 0x00, 0x0d, 0x60, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0xc1, 0xb0, 0x06, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0x12, 0x0a, 
-	0xcd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x84, 0x21, 0x1a, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x44, 
-	0x60, 0x2b, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x80, 0x22, 0x29, 0x8e, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x4d, 0x11, 0x3f, 0xca, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xc0, 0x40, 0x00, 0x0d, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x40, 0x02, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x80, 0x01, 0x00, 0x0d, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x7f, 0xff, 0xff, 0xfd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0xdb, 0x6d, 0xad, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x0d, 0x20, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 
-	0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x80, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 
-	0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xc0, 0x2a, 0xa8, 0x4d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x40, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x40, 0x40, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x81, 0x80, 0x00, 0x0d, 
-	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x43, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xda, 0x3f, 
-	0xff, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x4c, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x80, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x02, 
-	0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x05, 0x64, 0x92, 0x94, 
-	0xa5, 0x29, 0x4a, 0x52, 0x94, 0xa5, 0x54, 0x28, 0x50, 0xa1, 0x42, 0x85, 0x0a, 0x14, 0x28, 0x54, 
-	0x91, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x40, 0x3f, 0xff, 0x8d, 0xa4, 
-	0x94, 0x92, 0x49, 0x24, 0x92, 0x49, 0x49, 0x29, 0x25, 0x4a, 0x95, 0x29, 0x29, 0x52, 0xa4, 0xa5, 
-	0x25, 0x24, 0x95, 0x55, 0xc0, 0x00, 0x00, 0x85, 0x55, 0x6a, 0xd5, 0xad, 0x5b, 0x5a, 0xb6, 0xaa, 
-	0xd5, 0x55, 0x55, 0x55, 0x56, 0xaa, 0xaa, 0xab, 0x55, 0x5a, 0xab, 0x6a, 0xab, 0x40, 0x00, 0x00, 
-	0x0d, 0x55, 0x55, 0x55, 0x55, 0x54, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x2a, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 
-	0x00, 0x00, 0x0d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x80, 0x00, 0x40, 0x05, 0x6e, 0xdb, 0x6d, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x6d, 0xf7, 0x7d, 0xdf, 0xdd, 0xdd, 0xfb, 0xbb, 0xfb, 
-	0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x40, 0x00, 0x00, 0xff, 0xfb, 0xba, 0xdb, 0x08, 0x5b, 0xb8, 0x41, 
-	0x00, 0x00, 0x00, 0x88, 0xa2, 0x48, 0x84, 0x46, 0x88, 0xd5, 0xc0, 0x3f, 0xff, 0x8d, 0x40, 0x00, 
-	0x00, 0xff, 0xfd, 0xdf, 0x77, 0x6b, 0x6e, 0xef, 0x7f, 0x00, 0x48, 0x89, 0x05, 0x77, 0x45, 0x31, 
-	0x12, 0xad, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xee, 0xeb, 0xdd, 0x55, 0x7b, 
-	0xb9, 0x00, 0x00, 0x40, 0x4e, 0x72, 0xaa, 0xe2, 0x12, 0xaa, 0xee, 0xd5, 0x80, 0x00, 0x00, 0x0a, 
-	0xc3, 0xff, 0xf8, 0xff, 0xfd, 0xdd, 0x7f, 0x55, 0x5e, 0xed, 0xff, 0x00, 0x41, 0x08, 0x85, 0x9c, 
-	0x94, 0xaa, 0xaa, 0x99, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf0, 0xff, 0xfb, 0xbf, 0xd5, 
-	0xaa, 0xb7, 0xb8, 0x00, 0x00, 0x42, 0x28, 0x8a, 0xaa, 0xc8, 0x94, 0x03, 0x88, 0xd5, 0x80, 0x00, 
-	0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xfd, 0xd5, 0x7f, 0x55, 0x6d, 0xef, 0xff, 0x08, 0x48, 0x08, 
-	0x89, 0x67, 0x4a, 0x91, 0x12, 0xad, 0xd6, 0x40, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf8, 0xff, 0xee, 
-	0xff, 0xeb, 0x55, 0x7e, 0xb8, 0x01, 0x00, 0x44, 0x4a, 0x22, 0x2a, 0x62, 0x32, 0xaa, 0xea, 0xd5, 
-	0xc0, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0xff, 0xff, 0xda, 0xdf, 0x55, 0x57, 0xed, 0xdd, 0x00, 
-	0x41, 0x09, 0x55, 0xdc, 0xa2, 0x2a, 0xa2, 0xaa, 0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf0, 
-	0xaa, 0xb1, 0x36, 0xb5, 0xaa, 0xba, 0xba, 0xab, 0xff, 0xfa, 0xbd, 0xab, 0x33, 0xdd, 0xdb, 0xbe, 
-	0xdd, 0xd5, 0x80, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0x80, 0x24, 0x04, 0x01, 0x12, 0x60, 0x0c, 
-	0x41, 0x00, 0x00, 0x00, 0x8a, 0xcc, 0x40, 0x0b, 0x9a, 0x00, 0x6b, 0x40, 0x3f, 0xff, 0x8d, 0x43, 
-	0xff, 0xf8, 0x00, 0x20, 0x12, 0x81, 0x44, 0x25, 0x48, 0xa6, 0x44, 0x48, 0x89, 0x14, 0x44, 0x51, 
-	0x1e, 0xa4, 0x84, 0x55, 0x80, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf9, 0x00, 0x20, 0x44, 0x11, 0x11, 
-	0x60, 0x2b, 0x11, 0x11, 0x80, 0x0a, 0x23, 0x33, 0x7f, 0xfc, 0xee, 0xaa, 0xea, 0x40, 0x00, 0x00, 
-	0x0d, 0xc3, 0xff, 0xf0, 0x80, 0x21, 0x04, 0x01, 0x44, 0x2a, 0x88, 0x01, 0x44, 0x62, 0x28, 0x8a, 
-	0x11, 0x40, 0x0a, 0xaa, 0x8c, 0xd5, 0xc0, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0x00, 0x20, 0x04, 
-	0x45, 0x12, 0xa0, 0x0c, 0x43, 0x00, 0x40, 0x08, 0x8a, 0xcc, 0x48, 0x93, 0x9a, 0x40, 0x55, 0x40, 
-	0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x80, 0x20, 0x04, 0x01, 0x24, 0x64, 0xac, 0x4d, 0x4a, 0x48, 
-	0xc9, 0x12, 0x44, 0x41, 0x1e, 0x64, 0x04, 0x6b, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x80, 
-	0x21, 0x10, 0x21, 0x01, 0x21, 0x09, 0x31, 0x11, 0x40, 0x0a, 0x23, 0x33, 0x7b, 0x7c, 0xee, 0xca, 
-	0xd5, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x01, 0x00, 0x24, 0x45, 0x05, 0x54, 0x64, 0x4a, 0x01, 
-	0x00, 0x53, 0x29, 0x11, 0x11, 0x4c, 0x93, 0xaa, 0xaa, 0xd5, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xaa, 0x92, 0x54, 0xa4, 0xaa, 0x4a, 
-	0x55, 0x55, 0x55, 0x49, 0x24, 0xaa, 0xa4, 0xa4, 0xa4, 0x49, 0x29, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x56, 
-	0xab, 0x55, 0xaa, 0xaa, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+// 'window_rle', 200x200px, PackBits
+const unsigned char window_rle [] PROGMEM = {
+	0x81, 0xff, 0x81, 0xff, 0xee, 0xff, 0xe9, 0x00, 0x01, 0x07, 0x02, 0xea, 0x00, 0x08, 0x01, 0x04,
+	0x00, 0x40, 0x00, 0x10, 0x10, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x40, 0xf5, 0x00, 0x0d, 0x01, 0x1b,
+	0x00, 0x8a, 0x40, 0x11, 0xc6, 0x01, 0x08, 0x46, 0x91, 0x00, 0x84, 0x44, 0xf5, 0x00, 0x0c, 0x1e,
+	0x00, 0x96, 0xa0, 0x12, 0xb4, 0x01, 0x15, 0x5a, 0xaa, 0x00, 0xca, 0xb4, 0xf6, 0x00, 0x0d, 0x01,
+	0x1f, 0x00, 0x9a, 0xe0, 0x12, 0x94, 0x01, 0x55, 0x55, 0xbb, 0x00, 0x8a, 0xa4, 0xf5, 0x00, 0x0c,
+	0x0e, 0x00, 0x92, 0x80, 0x32, 0xd6, 0x01, 0x55, 0x56, 0xa1, 0x80, 0xca, 0xb4, 0xf6, 0x00, 0x00,
+	0x01, 0xfe, 0x00, 0x08, 0x40, 0x09, 0x00, 0x00, 0x88, 0x88, 0x10, 0x00, 0x04, 0xdc, 0x00, 0x00,
+	0x01, 0xe8, 0x00, 0xe8, 0xff, 0x0b, 0x4a, 0xaa, 0xaa, 0xa5, 0x52, 0x55, 0x55, 0x49, 0x24, 0x95,
+	0x54, 0xa5, 0xfe, 0x55, 0x0a, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0xb5,
+	0xfd, 0x55, 0xed, 0xaa, 0x00, 0x4a, 0xf9, 0xaa, 0x00, 0xd5, 0xf2, 0x55, 0x03, 0xbf, 0xde, 0xff,
+	0xfa, 0xed, 0xaa, 0x0c, 0xab, 0x40, 0x01, 0x00, 0x0d, 0x5f, 0x77, 0x77, 0x7f, 0xff, 0x77, 0x77,
+	0xff, 0xfe, 0x77, 0x0e, 0x7d, 0xf7, 0x77, 0xdf, 0x77, 0x7d, 0xf7, 0x77, 0xdd, 0x55, 0xc0, 0x00,
+	0x00, 0x05, 0x60, 0xef, 0x00, 0x20, 0x01, 0xaa, 0x41, 0xe2, 0x36, 0x4d, 0x4d, 0xbb, 0x6d, 0xb6,
+	0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xbb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d,
+	0x55, 0x84, 0x09, 0x00, 0x2d, 0x6a, 0x02, 0xf0, 0xaa, 0x07, 0xa9, 0xab, 0x48, 0x08, 0x00, 0x06,
+	0xab, 0x05, 0xee, 0x55, 0x06, 0x88, 0x31, 0x20, 0x2d, 0x55, 0x05, 0x56, 0xf1, 0xaa, 0x2a, 0xad,
+	0xaa, 0x4b, 0x80, 0x00, 0x0d, 0x6a, 0x05, 0x6a, 0xd5, 0x55, 0xb6, 0xdb, 0x55, 0xb6, 0xd5, 0xb6,
+	0xd6, 0xdb, 0x6d, 0x6d, 0xb6, 0xdb, 0x5b, 0x6d, 0x69, 0x55, 0xc4, 0x02, 0x00, 0x0a, 0xab, 0x7a,
+	0xaa, 0xad, 0xb6, 0xaa, 0xaa, 0xb6, 0xaa, 0xad, 0x55, 0x5a, 0xfa, 0xaa, 0x06, 0xad, 0xab, 0x42,
+	0x01, 0x2a, 0xcd, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55, 0x84, 0x00, 0x00, 0x0d, 0x75, 0xee, 0x55,
+	0x05, 0xaa, 0x40, 0x02, 0x00, 0x05, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55, 0xf7, 0x7b, 0xff, 0xfd,
+	0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x40, 0x00, 0x00, 0x05, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x40, 0x82, 0x04, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x85, 0x60, 0x06, 0x0d, 0xa0, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x41, 0x29, 0x0a, 0x05, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0xc6, 0x28,
+	0x0b, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55, 0x4a, 0x02, 0x11, 0x0d, 0xa0, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x84, 0x11, 0x1d, 0x85, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x10, 0x20, 0x8d,
+	0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x82, 0x22, 0x20, 0xcd, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x40, 0x00, 0x61, 0xa5, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0xd5, 0x53, 0x14, 0x4d, 0x20, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x40, 0x0a, 0x82, 0x2d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x81, 0x00,
+	0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x42, 0x82, 0x20, 0x05, 0x20, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0xc2, 0x81, 0x16, 0x0d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55, 0x42, 0xa0, 0x05, 0x0d,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x44, 0x9a, 0x0b, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x88, 0x18, 0x0a, 0x05, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x32, 0x0b, 0x0d, 0x60, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0xc4, 0x59, 0x09, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x42, 0x90,
+	0x0b, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x80, 0x01, 0x00, 0x05, 0x50, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x7f, 0xff, 0x7b, 0xfd, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0xff, 0xfe, 0x00, 0x06,
+	0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x7f, 0x7e, 0x03, 0x0d, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0xff, 0x3e, 0x00, 0x8d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x7f, 0x7e, 0x07, 0x05, 0x50, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0xff, 0x3e, 0x01, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x7d, 0x5e,
+	0x0a, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55, 0xfc, 0x9e, 0x12, 0x05, 0xa0, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x7f, 0xfe, 0x14, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0xfc, 0x9e, 0x18, 0x0d,
+	0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x7a, 0x5e, 0x00, 0x05, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0xff, 0xff, 0x52, 0x4d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x02, 0x09, 0x2d, 0x20, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x80, 0x01, 0x00, 0x0d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x40, 0x00,
+	0x03, 0x85, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x88, 0x02, 0x04, 0x4d, 0x20, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x46, 0x01, 0x08, 0xcd, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55, 0xc1, 0x82, 0x11, 0x8d,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x40, 0x60, 0x2b, 0x05, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x80, 0x12, 0x26, 0x0d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x01, 0x34, 0x0c, 0xa0, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x80, 0x00, 0x00, 0x06, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x40, 0x02,
+	0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0xff, 0xfb, 0xfb, 0xed, 0x50, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x80, 0x02, 0x00, 0x05,
+	0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x4d, 0xb1, 0x3e, 0xcd, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x80, 0x08, 0x22, 0xad, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x48, 0x09, 0x35, 0x45, 0x20, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0xc8, 0x08, 0x2a, 0xcd, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x48, 0x0a,
+	0x2a, 0xad, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x8a, 0xa8, 0x3f, 0xc5, 0x20, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x52, 0xa9, 0x22, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0xc8, 0x45, 0x49, 0x55, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x50, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x47, 0xf1,
+	0x1f, 0xc5, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55, 0x88, 0x08, 0x2a, 0x4d, 0x60, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x48, 0x09, 0x35, 0xad, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55, 0xc8, 0x08, 0x2a, 0x8d,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x40, 0x02, 0x2a, 0xc5, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x87, 0x61, 0x1d, 0x0d, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x7f, 0xff,
+	0xf7, 0xf5, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55, 0x80, 0x00, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0x55, 0xc2, 0xc0, 0x0d, 0x05,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x44, 0x32, 0x15, 0xcd, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x88, 0x08, 0x2a, 0xad, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x48, 0x09, 0x35, 0x45, 0x40, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x88, 0x10, 0x35, 0x4d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x46, 0xb2,
+	0x1f, 0x8d, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55, 0xc0, 0x01, 0x00, 0x06, 0xa0, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x82, 0x93, 0x00, 0x4d,
+	0x20, 0xef, 0x00, 0x06, 0x01, 0xab, 0x69, 0x4a, 0xb6, 0x95, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x80, 0x00, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x02, 0x00, 0x0d, 0x20, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0xc7, 0x31, 0x19, 0x8d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x48, 0x88,
+	0x2e, 0xc5, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55, 0x88, 0x09, 0x32, 0x4d, 0x60, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x40, 0x10, 0x2a, 0xcd, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55, 0x84, 0x22, 0x15, 0x8d,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x41, 0x81, 0x0e, 0x05, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0xc0, 0x00, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x40, 0x02, 0x00, 0x0d, 0x40, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x7f, 0xfb, 0xf7, 0xb5, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x80, 0x00,
+	0x00, 0x0d, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x02, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0xc1, 0xb0, 0x06, 0xc5, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55, 0x42, 0x12, 0x0a, 0xcd,
+	0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x84, 0x21, 0x1a, 0x8d, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55,
+	0x44, 0x60, 0x2b, 0x05, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x80, 0x22, 0x29, 0x8e, 0xa0, 0xef,
+	0x00, 0x06, 0x01, 0x55, 0x4d, 0x11, 0x3f, 0xca, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0xc0, 0x40,
+	0x00, 0x0d, 0x50, 0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x02, 0x00, 0x05, 0x60, 0xef, 0x00, 0x06,
+	0x01, 0xaa, 0x80, 0x01, 0x00, 0x0d, 0x40, 0xef, 0x00, 0x06, 0x01, 0x55, 0x7f, 0xff, 0xff, 0xfd,
+	0x60, 0xef, 0x00, 0x01, 0x01, 0xab, 0xfd, 0xaa, 0x00, 0xa0, 0xef, 0x00, 0x00, 0x01, 0xfc, 0x55,
+	0x00, 0x60, 0xef, 0x00, 0x00, 0x01, 0xfc, 0xaa, 0x00, 0xa0, 0xef, 0x00, 0x00, 0x01, 0xfc, 0x55,
+	0x00, 0x50, 0xef, 0x00, 0x06, 0x01, 0xab, 0xdb, 0x6d, 0xad, 0xad, 0x60, 0xef, 0x00, 0x06, 0x01,
+	0x55, 0x40, 0x00, 0x00, 0x0d, 0x20, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0xa0,
+	0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x00, 0x00, 0x04, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0x80,
+	0x00, 0x00, 0x0e, 0xa0, 0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x00, 0x00, 0x0a, 0xa0, 0xef, 0x00,
+	0x06, 0x01, 0xaa, 0xc0, 0x2a, 0xa8, 0x4d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x40, 0x00, 0x00,
+	0x05, 0x60, 0xef, 0x00, 0x06, 0x01, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x50, 0xef, 0x00, 0x06, 0x01,
+	0x55, 0x40, 0x40, 0x00, 0x0d, 0x60, 0xef, 0x00, 0x06, 0x01, 0xaa, 0x81, 0x80, 0x00, 0x0d, 0x20,
+	0xef, 0x00, 0x06, 0x01, 0x55, 0x43, 0x00, 0x00, 0x05, 0xa0, 0xef, 0x00, 0x06, 0x01, 0xab, 0xda,
+	0x3f, 0xff, 0x8d, 0x60, 0xef, 0x00, 0x06, 0x01, 0x55, 0x4c, 0x00, 0x00, 0x0d, 0x20, 0xef, 0x00,
+	0x06, 0x01, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0xa0, 0xf8, 0x00, 0x28, 0x81, 0x02, 0x04, 0x08, 0x10,
+	0x20, 0x40, 0x81, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x05, 0x64, 0x92, 0x94, 0xa5, 0x29, 0x4a,
+	0x52, 0x94, 0xa5, 0x54, 0x28, 0x50, 0xa1, 0x42, 0x85, 0x0a, 0x14, 0x28, 0x54, 0x91, 0xab, 0x80,
+	0x00, 0x00, 0x0d, 0x3f, 0xee, 0xff, 0x26, 0x55, 0x40, 0x3f, 0xff, 0x8d, 0xa4, 0x94, 0x92, 0x49,
+	0x24, 0x92, 0x49, 0x49, 0x29, 0x25, 0x4a, 0x95, 0x29, 0x29, 0x52, 0xa4, 0xa5, 0x25, 0x24, 0x95,
+	0x55, 0xc0, 0x00, 0x00, 0x85, 0x55, 0x6a, 0xd5, 0xad, 0x5b, 0x5a, 0xb6, 0xaa, 0xd5, 0xfe, 0x55,
+	0x0c, 0x56, 0xaa, 0xaa, 0xab, 0x55, 0x5a, 0xab, 0x6a, 0xab, 0x40, 0x00, 0x00, 0x0d, 0xfd, 0x55,
+	0x02, 0x54, 0xaa, 0xa9, 0xf5, 0x55, 0x05, 0x2a, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0xec, 0x55, 0x03,
+	0x40, 0x00, 0x00, 0x0d, 0xf9, 0x55, 0x00, 0x4a, 0xf6, 0xaa, 0x07, 0xab, 0x80, 0x00, 0x40, 0x05,
+	0x6e, 0xdb, 0x6d, 0xfb, 0xff, 0x1a, 0xfe, 0xef, 0x6d, 0xf7, 0x7d, 0xdf, 0xdd, 0xdd, 0xfb, 0xbb,
+	0xfb, 0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x40, 0x00, 0x00, 0xff, 0xfb, 0xba, 0xdb, 0x08, 0x5b, 0xb8,
+	0x41, 0xfe, 0x00, 0x7f, 0x88, 0xa2, 0x48, 0x84, 0x46, 0x88, 0xd5, 0xc0, 0x3f, 0xff, 0x8d, 0x40,
+	0x00, 0x00, 0xff, 0xfd, 0xdf, 0x77, 0x6b, 0x6e, 0xef, 0x7f, 0x00, 0x48, 0x89, 0x05, 0x77, 0x45,
+	0x31, 0x12, 0xad, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xee, 0xeb, 0xdd, 0x55,
+	0x7b, 0xb9, 0x00, 0x00, 0x40, 0x4e, 0x72, 0xaa, 0xe2, 0x12, 0xaa, 0xee, 0xd5, 0x80, 0x00, 0x00,
+	0x0a, 0xc3, 0xff, 0xf8, 0xff, 0xfd, 0xdd, 0x7f, 0x55, 0x5e, 0xed, 0xff, 0x00, 0x41, 0x08, 0x85,
+	0x9c, 0x94, 0xaa, 0xaa, 0x99, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf0, 0xff, 0xfb, 0xbf,
+	0xd5, 0xaa, 0xb7, 0xb8, 0x00, 0x00, 0x42, 0x28, 0x8a, 0xaa, 0xc8, 0x94, 0x03, 0x88, 0xd5, 0x80,
+	0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xfd, 0xd5, 0x7f, 0x55, 0x6d, 0xef, 0xff, 0x08, 0x48,
+	0x08, 0x89, 0x67, 0x4a, 0x5d, 0x91, 0x12, 0xad, 0xd6, 0x40, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf8,
+	0xff, 0xee, 0xff, 0xeb, 0x55, 0x7e, 0xb8, 0x01, 0x00, 0x44, 0x4a, 0x22, 0x2a, 0x62, 0x32, 0xaa,
+	0xea, 0xd5, 0xc0, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0xff, 0xff, 0xda, 0xdf, 0x55, 0x57, 0xed,
+	0xdd, 0x00, 0x41, 0x09, 0x55, 0xdc, 0xa2, 0x2a, 0xa2, 0xaa, 0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x43,
+	0xff, 0xf0, 0xaa, 0xb1, 0x36, 0xb5, 0xaa, 0xba, 0xba, 0xab, 0xff, 0xfa, 0xbd, 0xab, 0x33, 0xdd,
+	0xdb, 0xbe, 0xdd, 0xd5, 0x80, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0x80, 0x24, 0x04, 0x01, 0x12,
+	0x60, 0x0c, 0x41, 0xfe, 0x00, 0x7f, 0x8a, 0xcc, 0x40, 0x0b, 0x9a, 0x00, 0x6b, 0x40, 0x3f, 0xff,
+	0x8d, 0x43, 0xff, 0xf8, 0x00, 0x20, 0x12, 0x81, 0x44, 0x25, 0x48, 0xa6, 0x44, 0x48, 0x89, 0x14,
+	0x44, 0x51, 0x1e, 0xa4, 0x84, 0x55, 0x80, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf9, 0x00, 0x20, 0x44,
+	0x11, 0x11, 0x60, 0x2b, 0x11, 0x11, 0x80, 0x0a, 0x23, 0x33, 0x7f, 0xfc, 0xee, 0xaa, 0xea, 0x40,
+	0x00, 0x00, 0x0d, 0xc3, 0xff, 0xf0, 0x80, 0x21, 0x04, 0x01, 0x44, 0x2a, 0x88, 0x01, 0x44, 0x62,
+	0x28, 0x8a, 0x11, 0x40, 0x0a, 0xaa, 0x8c, 0xd5, 0xc0, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0x00,
+	0x20, 0x04, 0x45, 0x12, 0xa0, 0x0c, 0x43, 0x00, 0x40, 0x08, 0x8a, 0xcc, 0x48, 0x93, 0x9a, 0x40,
+	0x55, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x80, 0x20, 0x04, 0x01, 0x24, 0x64, 0xac, 0x4d,
+	0x4a, 0x48, 0xc9, 0x12, 0x44, 0x41, 0x35, 0x1e, 0x64, 0x04, 0x6b, 0x80, 0x00, 0x00, 0x05, 0x40,
+	0x00, 0x00, 0x80, 0x21, 0x10, 0x21, 0x01, 0x21, 0x09, 0x31, 0x11, 0x40, 0x0a, 0x23, 0x33, 0x7b,
+	0x7c, 0xee, 0xca, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x01, 0x00, 0x24, 0x45, 0x05, 0x54,
+	0x64, 0x4a, 0x01, 0x00, 0x53, 0x29, 0x11, 0x11, 0x4c, 0x93, 0xaa, 0xaa, 0xd5, 0xfe, 0xff, 0x01,
+	0xfd, 0x7f, 0xee, 0xff, 0x00, 0xd5, 0xfb, 0x55, 0x06, 0x54, 0xaa, 0x92, 0x54, 0xa4, 0xaa, 0x4a,
+	0xfe, 0x55, 0x02, 0x49, 0x24, 0xaa, 0xfe, 0xa4, 0x02, 0x49, 0x29, 0x55, 0xf7, 0xaa, 0x00, 0xab,
+	0xfb, 0x55, 0x07, 0x5b, 0x55, 0x56, 0xab, 0x55, 0xaa, 0xaa, 0xab, 0x81, 0xff, 0x81, 0xff, 0xee,
+	0xff
 };
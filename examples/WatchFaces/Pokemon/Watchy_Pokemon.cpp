@@ -1,8 +1,7 @@
 #include "Watchy_Pokemon.h"
 
 void WatchyPokemon::drawWatchFace(){
-    display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, pokemon, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+    display.drawBitmapRLE(0, 0, pokemon_rle, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK, GxEPD_WHITE);
     display.setTextColor(GxEPD_BLACK);
     display.setFont(&FreeMonoBold9pt7b);
     display.setCursor(10, 170);
@@ -8,58 +8,39 @@
 #include "stars.h"
 #include "settings.h"
 
-#define STAR_COUNT 900
-
 const int horizonY = 150;
 const int planetR = 650;
 
-struct xyPoint {
-  int x;
-  int y;
+// sin(2 * PI * i / 60) in Q15, one entry per minute. cos(i) is sin(i + 15).
+// int32_t so 1.0 is exact and the quarter hours rotate without rounding error
+const int32_t SIN_Q15[60] PROGMEM = {
+       0,   3425,   6813,  10126,  13328,  16384,  19261,  21926,  24351,  26510,
+   28378,  29935,  31164,  32052,  32588,  32768,  32588,  32052,  31164,  29935,
+   28378,  26510,  24351,  21926,  19261,  16384,  13328,  10126,   6813,   3425,
+       0,  -3425,  -6813, -10126, -13328, -16384, -19261, -21926, -24351, -26510,
+  -28378, -29935, -31164, -32052, -32588, -32768, -32588, -32052, -31164, -29935,
+  -28378, -26510, -24351, -21926, -19261, -16384, -13328, -10126,  -6813,  -3425,
 };
 
-//Star myStars[STAR_COUNT];
-void initStars() {
-  // The random star field is loaded from PROGMEM - see stars.h
-  // this is the function that was used to generate the stars in stars.h
-  // it does not run normally but can be used to re-generate stars with different parameters
-  // tweak as needed, call this function in init, open serial monitor, and paste the results into stars.h
-  srand(5287); // randomSeed() is not stable on ESP32, use srand
-  printf("const Star STARS[] PROGMEM = {\n");
-  for(int i = 0; i < STAR_COUNT; i++) {
-    int starX = (rand() % 260) - 30;
-    int starY = (rand() % 260) - 30;
-    int radius = 0;
-    if (i > STAR_COUNT * 0.99) radius = 2;
-    else if (i > STAR_COUNT * 0.80) radius = 1;
-    printf("  { %d, %d, %d },\n", starX, starY, radius);
-//    myStars[i] = { starX, starY, radius };
-  }
-  printf("};\n");
-}
-
-struct xyPoint rotatePointAround(int x, int y, int ox, int oy, double angle) {
-  // rotate X,Y point around given origin point by a given angle
-  // based on https://gist.github.com/LyleScott/e36e08bfb23b1f87af68c9051f985302#file-rotate_2d_point-py-L38
-  double qx = (double)ox + (cos(angle) * (double)(x - ox)) + (sin(angle) * (double)(y - oy));
-  double qy = (double)oy + (-sin(angle) * (double)(x - ox)) + (cos(angle) * (double)(y - oy));
-  struct xyPoint newPoint;
-  newPoint.x = (int)qx;
-  newPoint.y = (int)qy;
-  return newPoint;
+// Q15 fixed point to int, truncating toward zero like the (int) cast of the old double math
+inline int q15ToInt(int32_t q) {
+  return q >= 0 ? (q >> 15) : -((-q) >> 15);
 }
 
 class StarryHorizon : public Watchy {
     public:
         StarryHorizon(const watchySettings& s) : Watchy(s) {
-          // uncomment to re-generate stars
-          // initStars();
+          // the star field in stars.h is generated by tools/stargen.py
         }
-        void drawWatchFace(){
+        bool drawWatchFaceBackground(){
+          // the planet and grid never change, they are drawn once and cached by Watchy
           display.fillScreen(GxEPD_BLACK);
           display.fillCircle(100, horizonY + planetR, planetR, GxEPD_WHITE);
           drawGrid();
-          drawStars(STARS);
+          return true;
+        }
+        void drawWatchFace(){
+          drawStars();
           drawTime();
           drawDate();
         }
@@ -77,26 +58,42 @@ class StarryHorizon : public Watchy {
             display.drawLine(x, 200, 100, vanishY, GxEPD_BLACK);
           }
         }
-        void drawStars(const Star stars[]) {
+        void drawStars() {
           // draw field of stars
           // rotate stars so that they make an entire revolution once per hour
           int minute = (int)currentTime.Minute;
-          double minuteAngle = ((2.0 * M_PI) / 60.0) * (double)minute;
-//          printf("Minute %d, angle %f\n", (int)currentTime.Minute, minuteAngle);
+          int32_t sinA = SIN_Q15[minute];
+          int32_t cosA = SIN_Q15[(minute + 15) % 60];
 
-          for(int starI = 0; starI < STAR_COUNT; starI++) {
-            int starX = stars[starI].x;
-            int starY = stars[starI].y;
-            int starR = stars[starI].r;
-
-            struct xyPoint rotated = rotatePointAround(starX, starY, 100, 100, minuteAngle);
-            if(rotated.x < 0 || rotated.y < 0 || rotated.x > 200 || rotated.y > horizonY) {
-              continue;
-            }
-            if(starR == 0) {
-              display.drawPixel(rotated.x, rotated.y, GxEPD_WHITE);
-            } else {
-              display.fillCircle(rotated.x, rotated.y, starR, GxEPD_WHITE);
+          const uint16_t *star = STARS;
+          for(int ring = 0; ring < STAR_RINGS; ring++) {
+            uint64_t visibleSectors = STAR_VISIBLE_SECTORS[ring];
+            for(int sector = 0; sector < STAR_SECTORS; sector++) {
+              const StarBin &bin = STAR_BINS[ring * STAR_SECTORS + sector];
+              // each minute turns the sky back by one sector, skip bins that end up off screen
+              if(!((visibleSectors >> ((sector - minute + STAR_SECTORS) % STAR_SECTORS)) & 1)) {
+                star += bin.count;
+                continue;
+              }
+              for(int i = 0; i < bin.count; i++, star++) {
+                int32_t dx = 2 * bin.x + (*star >> 9);
+                int32_t dy = 2 * bin.y + ((*star >> 2) & 0x7F);
+                int starR = *star & 0x03;
+                // rotate around the center, y first since most stars end up below the horizon
+                int y = q15ToInt((STAR_CENTER << 15) - sinA * dx + cosA * dy);
+                if(y < 0 || y > horizonY) {
+                  continue;
+                }
+                int x = q15ToInt((STAR_CENTER << 15) + cosA * dx + sinA * dy);
+                if(x < 0 || x > 200) {
+                  continue;
+                }
+                if(starR == 0) {
+                  display.drawPixel(x, y, GxEPD_WHITE);
+                } else {
+                  display.fillCircle(x, y, starR, GxEPD_WHITE);
+                }
+              }
             }
           }
         }
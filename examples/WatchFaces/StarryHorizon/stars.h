@@ -1,910 +1,160 @@
-struct Star {
-  int16_t x;
-  int16_t y;
-  int16_t r;
+// Generated by tools/stargen.py, do not edit. 800 of 900 stars, 2540 bytes of PROGMEM
+// stars off screen at every angle are dropped, the rest are sorted into polar bins around (100, 100)
+
+#define STAR_SECTORS 60 //one per minute
+#define STAR_RINGS 5
+#define STAR_BIN_COUNT (STAR_SECTORS * STAR_RINGS)
+#define STAR_CENTER 100
+
+struct StarBin {
+  uint8_t count;
+  int8_t x; //anchor, in steps of 2px from STAR_CENTER
+  int8_t y;
+};
+
+// bit s is set if a star of that ring rotated into screen sector s can be above the horizon
+const uint64_t STAR_VISIBLE_SECTORS[STAR_RINGS] PROGMEM = {
+  0xfffffffffffffffULL,
+  0xfffffffffff3fffULL,
+  0xfffffffffc000ffULL,
+  0xfffffffff00003fULL,
+  0x07c00f800000000ULL,
+};
+
+// bin ring * STAR_SECTORS + sector, its stars follow those of the previous bins in STARS
+const StarBin STAR_BINS[STAR_BIN_COUNT] PROGMEM = {
+  { 1, 24, 2 }, { 5, 3, 0 }, { 1, 6, 1 }, { 0, 0, 0 }, { 1, 10, 5 }, { 0, 0, 0 },
+  { 2, 2, 2 }, { 4, 1, 1 }, { 1, 9, 10 }, { 4, 2, 4 }, { 4, 1, 2 }, { 3, 4, 11 },
+  { 0, 0, 0 }, { 2, 3, 21 }, { 3, 0, 10 }, { 2, -2, 14 }, { 1, -3, 22 }, { 2, -4, 6 },
+  { 0, 0, 0 }, { 2, -11, 14 }, { 2, -11, 1 }, { 0, 0, 0 }, { 5, -17, 6 }, { 1, -14, 10 },
+  { 2, -18, 9 }, { 1, -21, 10 }, { 1, -11, 4 }, { 2, -24, 5 }, { 4, -26, 0 }, { 1, -17, 0 },
+  { 1, -21, -1 }, { 3, -24, -5 }, { 3, -23, -6 }, { 0, 0, 0 }, { 4, -18, -9 }, { 6, -22, -13 },
+  { 2, -21, -16 }, { 3, -18, -17 }, { 2, -16, -19 }, { 3, -13, -21 }, { 2, -11, -23 }, { 2, -10, -25 },
+  { 2, -6, -21 }, { 1, -5, -26 }, { 3, -2, -22 }, { 2, 0, -23 }, { 0, 0, 0 }, { 3, 3, -20 },
+  { 2, 4, -24 }, { 1, 11, -23 }, { 1, 5, -8 }, { 3, 6, -18 }, { 5, 11, -19 }, { 5, 3, -16 },
+  { 0, 0, 0 }, { 1, 20, -10 }, { 0, 0, 0 }, { 3, 16, -6 }, { 3, 17, -4 }, { 2, 21, -2 },
+  { 1, 33, 0 }, { 1, 32, 5 }, { 0, 0, 0 }, { 3, 26, 10 }, { 3, 27, 14 }, { 2, 23, 14 },
+  { 1, 28, 22 }, { 0, 0, 0 }, { 3, 19, 25 }, { 2, 17, 27 }, { 3, 12, 27 }, { 2, 11, 26 },
+  { 2, 7, 31 }, { 0, 0, 0 }, { 4, 1, 30 }, { 3, -3, 29 }, { 3, -6, 26 }, { 1, -11, 36 },
+  { 3, -12, 26 }, { 0, 0, 0 }, { 3, -21, 28 }, { 2, -23, 28 }, { 1, -28, 25 }, { 2, -25, 19 },
+  { 3, -29, 15 }, { 0, 0, 0 }, { 3, -36, 12 }, { 3, -36, 8 }, { 2, -31, 4 }, { 6, -37, 0 },
+  { 4, -37, -3 }, { 3, -36, -7 }, { 0, 0, 0 }, { 0, 0, 0 }, { 2, -26, -15 }, { 1, -24, -15 },
+  { 3, -28, -22 }, { 1, -22, -22 }, { 1, -25, -29 }, { 4, -21, -32 }, { 3, -16, -35 }, { 0, 0, 0 },
+  { 1, -8, -30 }, { 4, -7, -36 }, { 3, -3, -35 }, { 4, 0, -37 }, { 3, 3, -36 }, { 0, 0, 0 },
+  { 1, 12, -35 }, { 2, 13, -34 }, { 3, 16, -29 }, { 0, 0, 0 }, { 3, 18, -26 }, { 2, 24, -21 },
+  { 2, 28, -20 }, { 1, 32, -17 }, { 1, 25, -10 }, { 6, 28, -10 }, { 3, 28, -7 }, { 1, 27, -2 },
+  { 4, 38, 0 }, { 4, 42, 4 }, { 2, 43, 12 }, { 2, 36, 13 }, { 6, 35, 16 }, { 1, 39, 26 },
+  { 5, 32, 25 }, { 3, 29, 26 }, { 2, 26, 34 }, { 4, 21, 33 }, { 4, 18, 37 }, { 1, 16, 37 },
+  { 0, 0, 0 }, { 3, 5, 40 }, { 1, 2, 43 }, { 3, -4, 42 }, { 3, -8, 41 }, { 1, -12, 40 },
+  { 6, -16, 35 }, { 4, -23, 34 }, { 2, -26, 32 }, { 2, -30, 29 }, { 4, -35, 27 }, { 3, -36, 26 },
+  { 2, -42, 23 }, { 2, -44, 19 }, { 5, -46, 13 }, { 6, -48, 9 }, { 2, -47, 7 }, { 5, -49, 1 },
+  { 3, -50, -2 }, { 3, -49, -10 }, { 3, -48, -11 }, { 5, -46, -17 }, { 2, -44, -20 }, { 4, -40, -29 },
+  { 4, -38, -32 }, { 5, -37, -34 }, { 2, -28, -35 }, { 2, -26, -43 }, { 5, -23, -43 }, { 0, 0, 0 },
+  { 5, -15, -46 }, { 3, -9, -47 }, { 4, -4, -50 }, { 0, 0, 0 }, { 2, 7, -47 }, { 3, 9, -48 },
+  { 2, 16, -45 }, { 3, 20, -41 }, { 1, 24, -41 }, { 3, 24, -38 }, { 3, 31, -34 }, { 1, 35, -27 },
+  { 2, 37, -27 }, { 1, 37, -20 }, { 1, 37, -14 }, { 4, 37, -11 }, { 2, 41, -8 }, { 3, 41, -5 },
+  { 8, 51, 2 }, { 2, 50, 7 }, { 4, 49, 13 }, { 6, 47, 17 }, { 3, 44, 24 }, { 5, 41, 29 },
+  { 6, 40, 33 }, { 2, 36, 37 }, { 3, 32, 39 }, { 2, 30, 47 }, { 2, 24, 48 }, { 4, 16, 48 },
+  { 3, 13, 53 }, { 1, 7, 53 }, { 7, 0, 50 }, { 3, -5, 52 }, { 2, -11, 54 }, { 2, -16, 52 },
+  { 4, -22, 48 }, { 5, -28, 46 }, { 7, -34, 45 }, { 4, -38, 40 }, { 6, -45, 37 }, { 2, -50, 34 },
+  { 8, -51, 27 }, { 6, -52, 24 }, { 4, -51, 18 }, { 1, -49, 15 }, { 4, -60, 7 }, { 7, -60, 2 },
+  { 4, -62, -5 }, { 2, -58, -11 }, { 2, -59, -18 }, { 3, -56, -20 }, { 2, -49, -25 }, { 2, -52, -35 },
+  { 2, -43, -35 }, { 3, -43, -41 }, { 5, -41, -47 }, { 6, -33, -51 }, { 3, -28, -53 }, { 5, -23, -55 },
+  { 5, -17, -60 }, { 1, -11, -58 }, { 6, -6, -59 }, { 3, 4, -61 }, { 5, 6, -61 }, { 3, 13, -60 },
+  { 0, 0, 0 }, { 4, 22, -53 }, { 3, 28, -50 }, { 4, 33, -46 }, { 1, 38, -37 }, { 4, 41, -38 },
+  { 4, 42, -35 }, { 3, 46, -28 }, { 4, 50, -23 }, { 5, 50, -16 }, { 2, 56, -8 }, { 4, 50, -5 },
+  { 3, 62, 0 }, { 3, 62, 7 }, { 1, 63, 19 }, { 1, 58, 21 }, { 3, 58, 28 }, { 5, 56, 35 },
+  { 2, 51, 40 }, { 6, 46, 45 }, { 5, 42, 48 }, { 4, 36, 52 }, { 7, 27, 54 }, { 3, 24, 58 },
+  { 7, 13, 59 }, { 1, 8, 61 }, { 0, 0, 0 }, { 0, 0, 0 }, { 1, -11, 63 }, { 2, -18, 63 },
+  { 4, -26, 57 }, { 2, -32, 56 }, { 5, -39, 55 }, { 6, -45, 47 }, { 1, -49, 51 }, { 3, -54, 39 },
+  { 2, -58, 36 }, { 5, -64, 27 }, { 1, -63, 26 }, { 1, -61, 13 }, { 1, -62, 9 }, { 1, -63, 3 },
+  { 1, -62, -5 }, { 4, -64, -13 }, { 0, 0, 0 }, { 1, -59, -23 }, { 5, -64, -34 }, { 3, -59, -39 },
+  { 2, -54, -46 }, { 2, -52, -50 }, { 3, -47, -56 }, { 6, -39, -60 }, { 4, -35, -62 }, { 2, -27, -65 },
+  { 2, -19, -63 }, { 0, 0, 0 }, { 2, -4, -64 }, { 0, 0, 0 }, { 0, 0, 0 }, { 1, 19, -63 },
+  { 3, 20, -62 }, { 2, 29, -61 }, { 1, 42, -59 }, { 9, 40, -56 }, { 4, 48, -53 }, { 3, 48, -44 },
+  { 2, 52, -38 }, { 5, 55, -34 }, { 1, 61, -24 }, { 0, 0, 0 }, { 1, 64, -9 }, { 0, 0, 0 },
 };
 
-// pre-generated random star field
-// run initStars to re-generate with different params
-const Star STARS[] PROGMEM = {
-  { 158, 153, 0 },
-  { 180, 217, 0 },
-  { 229, 208, 0 },
-  { 17, 153, 0 },
-  { 115, 13, 0 },
-  { 174, 78, 0 },
-  { 27, 181, 0 },
-  { 80, 15, 0 },
-  { 105, 27, 0 },
-  { 149, -5, 0 },
-  { 12, 150, 0 },
-  { 142, 88, 0 },
-  { 79, 226, 0 },
-  { 159, -19, 0 },
-  { 219, 112, 0 },
-  { 182, 97, 0 },
-  { 167, 225, 0 },
-  { 199, -2, 0 },
-  { 191, 169, 0 },
-  { 209, 24, 0 },
-  { 28, 87, 0 },
-  { 29, -18, 0 },
-  { 66, 107, 0 },
-  { 85, 182, 0 },
-  { 29, -9, 0 },
-  { 141, 108, 0 },
-  { 185, -24, 0 },
-  { 200, 193, 0 },
-  { 135, 128, 0 },
-  { 8, 66, 0 },
-  { 19, 103, 0 },
-  { 52, 74, 0 },
-  { 203, -6, 0 },
-  { 20, 42, 0 },
-  { 59, 106, 0 },
-  { -5, 213, 0 },
-  { 29, 118, 0 },
-  { 215, 85, 0 },
-  { 67, 169, 0 },
-  { 213, 212, 0 },
-  { 15, 37, 0 },
-  { 5, 79, 0 },
-  { 78, 172, 0 },
-  { 4, 138, 0 },
-  { 35, 5, 0 },
-  { 180, 170, 0 },
-  { 61, -3, 0 },
-  { 29, 53, 0 },
-  { 156, 58, 0 },
-  { 162, 38, 0 },
-  { -26, 153, 0 },
-  { 11, 183, 0 },
-  { 76, 181, 0 },
-  { -27, 14, 0 },
-  { 195, 112, 0 },
-  { -26, 185, 0 },
-  { 76, 123, 0 },
-  { 208, 106, 0 },
-  { 123, 55, 0 },
-  { 227, 115, 0 },
-  { 105, 186, 0 },
-  { 29, 14, 0 },
-  { -10, 65, 0 },
-  { 52, 112, 0 },
-  { 56, -5, 0 },
-  { 40, 176, 0 },
-  { 42, 103, 0 },
-  { 94, 33, 0 },
-  { 194, 91, 0 },
-  { 19, 174, 0 },
-  { 121, -20, 0 },
-  { 7, 141, 0 },
-  { 50, 192, 0 },
-  { 96, 113, 0 },
-  { 40, -2, 0 },
-  { 205, 31, 0 },
-  { 64, 201, 0 },
-  { 205, 99, 0 },
-  { 181, 8, 0 },
-  { 178, 138, 0 },
-  { 196, 195, 0 },
-  { -23, -8, 0 },
-  { 89, 37, 0 },
-  { 1, 96, 0 },
-  { 59, 37, 0 },
-  { 113, 85, 0 },
-  { -8, 224, 0 },
-  { 125, 30, 0 },
-  { 131, 67, 0 },
-  { -27, 85, 0 },
-  { 6, -17, 0 },
-  { 215, 175, 0 },
-  { 193, -16, 0 },
-  { 55, 156, 0 },
-  { 119, 24, 0 },
-  { 94, 165, 0 },
-  { 207, 75, 0 },
-  { 195, 137, 0 },
-  { 33, 197, 0 },
-  { 204, 134, 0 },
-  { 59, 98, 0 },
-  { 217, 142, 0 },
-  { 36, 5, 0 },
-  { 104, 218, 0 },
-  { 176, 26, 0 },
-  { 163, 33, 0 },
-  { 91, 48, 0 },
-  { 206, 219, 0 },
-  { 114, -22, 0 },
-  { 27, 98, 0 },
-  { 61, 28, 0 },
-  { 108, -21, 0 },
-  { -8, 173, 0 },
-  { 225, 3, 0 },
-  { 68, 133, 0 },
-  { 116, 188, 0 },
-  { 38, 193, 0 },
-  { -22, 126, 0 },
-  { -8, 179, 0 },
-  { 140, 157, 0 },
-  { 205, 165, 0 },
-  { 143, 98, 0 },
-  { 148, 196, 0 },
-  { 2, 81, 0 },
-  { 49, 71, 0 },
-  { 6, 117, 0 },
-  { 74, -13, 0 },
-  { 161, 208, 0 },
-  { 183, 159, 0 },
-  { 48, 107, 0 },
-  { 72, -19, 0 },
-  { 166, 19, 0 },
-  { 172, 175, 0 },
-  { 3, 55, 0 },
-  { 18, 83, 0 },
-  { -26, 107, 0 },
-  { 58, 164, 0 },
-  { 202, 162, 0 },
-  { 13, 60, 0 },
-  { 85, 86, 0 },
-  { 211, 41, 0 },
-  { 29, 155, 0 },
-  { 144, 22, 0 },
-  { -24, 90, 0 },
-  { 161, 0, 0 },
-  { 5, 153, 0 },
-  { 115, 207, 0 },
-  { 105, 104, 0 },
-  { 124, 158, 0 },
-  { 226, 138, 0 },
-  { 65, 226, 0 },
-  { 181, 191, 0 },
-  { 151, -20, 0 },
-  { 78, 142, 0 },
-  { 149, 35, 0 },
-  { 56, 74, 0 },
-  { 50, 193, 0 },
-  { -13, 121, 0 },
-  { 16, 229, 0 },
-  { 162, 128, 0 },
-  { 36, 202, 0 },
-  { 171, 132, 0 },
-  { 144, 10, 0 },
-  { 197, 114, 0 },
-  { 83, 7, 0 },
-  { 217, -17, 0 },
-  { 218, 191, 0 },
-  { 106, 81, 0 },
-  { 0, -29, 0 },
-  { 181, -25, 0 },
-  { 2, 131, 0 },
-  { 106, 172, 0 },
-  { 39, 191, 0 },
-  { 167, 133, 0 },
-  { 13, 204, 0 },
-  { 15, 214, 0 },
-  { 129, 212, 0 },
-  { -19, 187, 0 },
-  { -23, 119, 0 },
-  { 207, 69, 0 },
-  { 134, 135, 0 },
-  { 15, 137, 0 },
-  { 19, 7, 0 },
-  { -13, 96, 0 },
-  { 105, 160, 0 },
-  { 16, -11, 0 },
-  { -2, 136, 0 },
-  { 39, 160, 0 },
-  { 45, 150, 0 },
-  { -11, 5, 0 },
-  { 76, 61, 0 },
-  { -16, 223, 0 },
-  { 109, 143, 0 },
-  { 144, 94, 0 },
-  { 69, 170, 0 },
-  { -13, 163, 0 },
-  { 141, -21, 0 },
-  { 152, -24, 0 },
-  { 44, 97, 0 },
-  { 98, 57, 0 },
-  { 201, -25, 0 },
-  { 222, 120, 0 },
-  { 132, 221, 0 },
-  { 199, 47, 0 },
-  { 64, 66, 0 },
-  { 105, 201, 0 },
-  { -12, -15, 0 },
-  { -22, 77, 0 },
-  { 59, 222, 0 },
-  { 52, 159, 0 },
-  { 28, 153, 0 },
-  { 20, 83, 0 },
-  { 90, 157, 0 },
-  { 159, 81, 0 },
-  { 99, -27, 0 },
-  { -11, 161, 0 },
-  { 194, -7, 0 },
-  { 52, 196, 0 },
-  { 156, 61, 0 },
-  { 187, -10, 0 },
-  { -22, 225, 0 },
-  { 139, 10, 0 },
-  { 95, 192, 0 },
-  { 172, 86, 0 },
-  { 220, 171, 0 },
-  { 182, -11, 0 },
-  { 8, 155, 0 },
-  { -18, -9, 0 },
-  { 67, 132, 0 },
-  { 11, -30, 0 },
-  { 146, 55, 0 },
-  { 201, 77, 0 },
-  { 117, 223, 0 },
-  { 227, 228, 0 },
-  { -7, 107, 0 },
-  { 102, 206, 0 },
-  { 81, 15, 0 },
-  { 135, 106, 0 },
-  { -29, -2, 0 },
-  { -7, 105, 0 },
-  { 62, 159, 0 },
-  { 59, 21, 0 },
-  { 154, 131, 0 },
-  { -11, 104, 0 },
-  { 24, -24, 0 },
-  { 23, 70, 0 },
-  { 10, 220, 0 },
-  { 192, 195, 0 },
-  { 123, 79, 0 },
-  { 178, 138, 0 },
-  { -12, -1, 0 },
-  { 48, 220, 0 },
-  { 25, 45, 0 },
-  { 67, 199, 0 },
-  { 6, 162, 0 },
-  { 2, 136, 0 },
-  { 171, 47, 0 },
-  { 173, 88, 0 },
-  { 93, 222, 0 },
-  { 139, 180, 0 },
-  { 130, 33, 0 },
-  { 53, 71, 0 },
-  { 39, 108, 0 },
-  { 175, 210, 0 },
-  { 112, 180, 0 },
-  { 155, 200, 0 },
-  { 69, -12, 0 },
-  { 30, 166, 0 },
-  { 197, -6, 0 },
-  { 214, 178, 0 },
-  { 71, 8, 0 },
-  { 126, 14, 0 },
-  { 54, 181, 0 },
-  { 41, 212, 0 },
-  { 145, 182, 0 },
-  { 187, 125, 0 },
-  { 53, 131, 0 },
-  { 83, 63, 0 },
-  { 81, 15, 0 },
-  { 85, 41, 0 },
-  { 54, -9, 0 },
-  { 30, -23, 0 },
-  { 35, 126, 0 },
-  { 40, 36, 0 },
-  { 2, 108, 0 },
-  { 112, 120, 0 },
-  { 64, 82, 0 },
-  { 218, 162, 0 },
-  { -8, 110, 0 },
-  { 87, 78, 0 },
-  { 182, 89, 0 },
-  { 44, 102, 0 },
-  { 227, -10, 0 },
-  { 186, 220, 0 },
-  { 209, 181, 0 },
-  { 180, -6, 0 },
-  { 126, 65, 0 },
-  { 166, 13, 0 },
-  { 191, 29, 0 },
-  { 210, 219, 0 },
-  { 80, 122, 0 },
-  { 109, 74, 0 },
-  { 75, 58, 0 },
-  { 155, 223, 0 },
-  { 153, 48, 0 },
-  { 164, 66, 0 },
-  { 78, 135, 0 },
-  { 159, 217, 0 },
-  { 70, 86, 0 },
-  { 136, 174, 0 },
-  { 56, 57, 0 },
-  { 125, 155, 0 },
-  { 40, -17, 0 },
-  { 193, 109, 0 },
-  { -28, 228, 0 },
-  { 90, 32, 0 },
-  { 18, 228, 0 },
-  { 107, 113, 0 },
-  { 14, 127, 0 },
-  { -26, 221, 0 },
-  { 159, 211, 0 },
-  { 69, 204, 0 },
-  { 78, 109, 0 },
-  { 91, 73, 0 },
-  { 16, 223, 0 },
-  { 134, 225, 0 },
-  { 23, 138, 0 },
-  { 38, 55, 0 },
-  { -20, 104, 0 },
-  { 4, 99, 0 },
-  { 221, 177, 0 },
-  { 108, 68, 0 },
-  { 216, 206, 0 },
-  { 97, -3, 0 },
-  { -23, 215, 0 },
-  { 127, -19, 0 },
-  { 39, 48, 0 },
-  { 66, 170, 0 },
-  { 211, 19, 0 },
-  { 18, 189, 0 },
-  { 11, 129, 0 },
-  { 93, 18, 0 },
-  { 157, 168, 0 },
-  { 71, 118, 0 },
-  { 88, -16, 0 },
-  { 188, 142, 0 },
-  { 97, 165, 0 },
-  { 184, 39, 0 },
-  { 27, 211, 0 },
-  { 172, 126, 0 },
-  { 46, 101, 0 },
-  { 61, 42, 0 },
-  { 75, -4, 0 },
-  { 18, 195, 0 },
-  { 164, 111, 0 },
-  { -27, 158, 0 },
-  { 63, -24, 0 },
-  { 159, 83, 0 },
-  { 225, 1, 0 },
-  { 146, 208, 0 },
-  { 38, 54, 0 },
-  { -10, 200, 0 },
-  { 22, 79, 0 },
-  { 208, -16, 0 },
-  { 229, 21, 0 },
-  { -2, 7, 0 },
-  { 171, 32, 0 },
-  { 57, 156, 0 },
-  { 160, 203, 0 },
-  { 219, 2, 0 },
-  { 202, 91, 0 },
-  { 26, -18, 0 },
-  { 192, 181, 0 },
-  { -20, 125, 0 },
-  { 47, 91, 0 },
-  { -10, 200, 0 },
-  { 38, -20, 0 },
-  { 68, 63, 0 },
-  { 103, 169, 0 },
-  { 68, 78, 0 },
-  { 112, -13, 0 },
-  { -16, 92, 0 },
-  { 2, 63, 0 },
-  { 72, 85, 0 },
-  { 209, 54, 0 },
-  { 218, 70, 0 },
-  { 27, 36, 0 },
-  { 145, 167, 0 },
-  { -25, -30, 0 },
-  { 131, -8, 0 },
-  { 135, 167, 0 },
-  { 119, 163, 0 },
-  { 18, 73, 0 },
-  { -18, 220, 0 },
-  { 127, 227, 0 },
-  { 45, 31, 0 },
-  { 198, 116, 0 },
-  { 133, 197, 0 },
-  { 12, 144, 0 },
-  { 114, 33, 0 },
-  { 218, 217, 0 },
-  { 106, 101, 0 },
-  { 117, 132, 0 },
-  { 127, 206, 0 },
-  { 184, 141, 0 },
-  { 228, -11, 0 },
-  { 87, 112, 0 },
-  { 122, 145, 0 },
-  { 43, 6, 0 },
-  { 90, 205, 0 },
-  { 26, 120, 0 },
-  { 198, 107, 0 },
-  { -20, 225, 0 },
-  { -26, 32, 0 },
-  { -27, 179, 0 },
-  { -3, 151, 0 },
-  { 111, 28, 0 },
-  { 223, 53, 0 },
-  { 45, -5, 0 },
-  { 154, -3, 0 },
-  { 50, 34, 0 },
-  { 193, 134, 0 },
-  { 31, 126, 0 },
-  { 132, 11, 0 },
-  { 128, 65, 0 },
-  { -24, 157, 0 },
-  { 100, 87, 0 },
-  { 21, 31, 0 },
-  { 156, 144, 0 },
-  { 191, 208, 0 },
-  { 134, 51, 0 },
-  { 75, 176, 0 },
-  { 18, 119, 0 },
-  { 101, 122, 0 },
-  { 99, 217, 0 },
-  { 221, 157, 0 },
-  { 172, 229, 0 },
-  { 186, 166, 0 },
-  { 2, 178, 0 },
-  { 149, 105, 0 },
-  { 66, 49, 0 },
-  { 200, 62, 0 },
-  { 107, 150, 0 },
-  { 29, 124, 0 },
-  { 223, 15, 0 },
-  { 80, 51, 0 },
-  { 41, 155, 0 },
-  { 59, 89, 0 },
-  { 164, 126, 0 },
-  { 159, 141, 0 },
-  { 198, 93, 0 },
-  { 35, 181, 0 },
-  { 129, 226, 0 },
-  { 4, 124, 0 },
-  { 23, 198, 0 },
-  { 138, -26, 0 },
-  { 22, -8, 0 },
-  { 134, 70, 0 },
-  { 56, 61, 0 },
-  { 157, 216, 0 },
-  { 217, 40, 0 },
-  { 222, 220, 0 },
-  { 52, -4, 0 },
-  { 13, 125, 0 },
-  { 220, 105, 0 },
-  { 49, 177, 0 },
-  { 92, 194, 0 },
-  { 26, 127, 0 },
-  { 107, 110, 0 },
-  { -25, 172, 0 },
-  { 207, 138, 0 },
-  { 228, 83, 0 },
-  { 80, 152, 0 },
-  { 36, 213, 0 },
-  { 136, 62, 0 },
-  { 135, 93, 0 },
-  { 223, 32, 0 },
-  { 199, 213, 0 },
-  { 203, 35, 0 },
-  { 200, 114, 0 },
-  { 165, 179, 0 },
-  { 212, 87, 0 },
-  { 158, 82, 0 },
-  { 113, 122, 0 },
-  { 132, 48, 0 },
-  { 221, 32, 0 },
-  { 121, -4, 0 },
-  { 93, -26, 0 },
-  { -18, -15, 0 },
-  { 158, -6, 0 },
-  { 172, 205, 0 },
-  { -14, 46, 0 },
-  { 144, 205, 0 },
-  { 22, 74, 0 },
-  { 212, 174, 0 },
-  { 228, 225, 0 },
-  { -23, 155, 0 },
-  { -17, 70, 0 },
-  { 144, 109, 0 },
-  { 91, 153, 0 },
-  { 98, 72, 0 },
-  { 201, 91, 0 },
-  { 66, -7, 0 },
-  { 72, 181, 0 },
-  { 32, 23, 0 },
-  { 135, 155, 0 },
-  { 13, 155, 0 },
-  { 98, 31, 0 },
-  { 186, -5, 0 },
-  { 170, 186, 0 },
-  { 103, 103, 0 },
-  { 105, 26, 0 },
-  { 192, 57, 0 },
-  { 144, 208, 0 },
-  { 39, 165, 0 },
-  { 47, 101, 0 },
-  { 34, 146, 0 },
-  { 198, 174, 0 },
-  { 158, 180, 0 },
-  { 156, 89, 0 },
-  { 83, 23, 0 },
-  { 202, 109, 0 },
-  { 67, 196, 0 },
-  { -15, -27, 0 },
-  { 135, 90, 0 },
-  { 207, 73, 0 },
-  { 38, 180, 0 },
-  { 186, 210, 0 },
-  { 92, 129, 0 },
-  { 4, 102, 0 },
-  { 209, 108, 0 },
-  { 88, 59, 0 },
-  { 102, 54, 0 },
-  { 133, 91, 0 },
-  { 110, 60, 0 },
-  { 22, -12, 0 },
-  { 96, 82, 0 },
-  { -11, 63, 0 },
-  { 92, 17, 0 },
-  { 102, 149, 0 },
-  { 224, 107, 0 },
-  { 24, 229, 0 },
-  { 69, 31, 0 },
-  { 46, 192, 0 },
-  { 24, 176, 0 },
-  { 161, 25, 0 },
-  { 113, 103, 0 },
-  { 132, 130, 0 },
-  { 163, 194, 0 },
-  { -14, -27, 0 },
-  { 200, 203, 0 },
-  { 88, 199, 0 },
-  { 72, 83, 0 },
-  { -17, 222, 0 },
-  { 82, 87, 0 },
-  { 157, 83, 0 },
-  { -28, 86, 0 },
-  { 181, 2, 0 },
-  { 63, 169, 0 },
-  { 188, 148, 0 },
-  { 195, 150, 0 },
-  { 107, 202, 0 },
-  { 229, 101, 0 },
-  { 226, -27, 0 },
-  { 105, 43, 0 },
-  { 36, 94, 0 },
-  { 171, 82, 0 },
-  { 224, 205, 0 },
-  { 152, 170, 0 },
-  { 11, 161, 0 },
-  { 209, 134, 0 },
-  { -15, 79, 0 },
-  { 95, -12, 0 },
-  { 61, 156, 0 },
-  { 139, 185, 0 },
-  { 105, 108, 0 },
-  { 163, 166, 0 },
-  { 68, 191, 0 },
-  { 172, 157, 0 },
-  { 5, 148, 0 },
-  { 178, 214, 0 },
-  { -9, 115, 0 },
-  { 87, 28, 0 },
-  { 57, 198, 0 },
-  { 119, 147, 0 },
-  { 129, 78, 0 },
-  { 94, -2, 0 },
-  { 98, 128, 0 },
-  { 140, 24, 0 },
-  { -15, 39, 0 },
-  { 116, 53, 0 },
-  { 71, 226, 0 },
-  { 143, 174, 0 },
-  { 199, 162, 0 },
-  { 208, 44, 0 },
-  { 101, 42, 0 },
-  { 181, 5, 0 },
-  { 58, 120, 0 },
-  { 57, 33, 0 },
-  { 184, -17, 0 },
-  { 27, 32, 0 },
-  { 174, 60, 0 },
-  { 139, 224, 0 },
-  { 141, 80, 0 },
-  { 21, 103, 0 },
-  { 29, 159, 0 },
-  { 97, 141, 0 },
-  { 24, 192, 0 },
-  { 174, 8, 0 },
-  { -27, 41, 0 },
-  { 217, 11, 0 },
-  { 85, 128, 0 },
-  { 186, 199, 0 },
-  { 202, 158, 0 },
-  { 210, 207, 0 },
-  { 135, 68, 0 },
-  { 115, 170, 0 },
-  { 64, 6, 0 },
-  { 79, 208, 0 },
-  { 174, 154, 0 },
-  { 78, 55, 0 },
-  { 153, 120, 0 },
-  { 210, 38, 0 },
-  { 216, 162, 0 },
-  { 15, 220, 0 },
-  { 196, 2, 0 },
-  { 6, 100, 0 },
-  { 166, 225, 0 },
-  { 72, 95, 0 },
-  { 206, 60, 0 },
-  { 179, -29, 0 },
-  { 19, -1, 0 },
-  { 121, 148, 0 },
-  { 86, 8, 0 },
-  { 50, 214, 0 },
-  { 28, 225, 0 },
-  { 120, 111, 0 },
-  { -18, 28, 0 },
-  { 83, 86, 0 },
-  { 38, 207, 0 },
-  { -14, 206, 0 },
-  { -3, 0, 0 },
-  { 187, -29, 0 },
-  { 100, 159, 0 },
-  { 107, 94, 0 },
-  { 73, 173, 0 },
-  { 206, -25, 0 },
-  { 174, 47, 0 },
-  { 137, 71, 0 },
-  { -16, 180, 0 },
-  { 52, 91, 0 },
-  { 66, 51, 0 },
-  { 51, -21, 0 },
-  { 185, 79, 0 },
-  { -6, 210, 0 },
-  { 110, 84, 0 },
-  { 138, 150, 0 },
-  { 191, 43, 0 },
-  { 4, 109, 0 },
-  { 173, 82, 0 },
-  { 95, 1, 0 },
-  { 183, 36, 0 },
-  { 186, -4, 0 },
-  { 194, 194, 0 },
-  { 170, 166, 0 },
-  { 97, 71, 0 },
-  { 21, 114, 0 },
-  { 206, 127, 0 },
-  { 156, 24, 0 },
-  { 110, 0, 0 },
-  { -2, 151, 0 },
-  { 199, -21, 0 },
-  { 20, 24, 0 },
-  { 27, 8, 0 },
-  { 0, 173, 0 },
-  { 67, 101, 0 },
-  { 21, 68, 0 },
-  { 39, 45, 0 },
-  { 109, 123, 0 },
-  { 72, 70, 0 },
-  { 149, 93, 0 },
-  { 179, 152, 0 },
-  { 175, 51, 0 },
-  { 66, -25, 0 },
-  { 127, 51, 0 },
-  { 71, 36, 0 },
-  { 49, 56, 0 },
-  { 207, 138, 0 },
-  { 15, 123, 0 },
-  { 40, 3, 0 },
-  { 135, 219, 0 },
-  { 96, 39, 0 },
-  { 109, -16, 0 },
-  { 222, -3, 0 },
-  { 45, -16, 0 },
-  { 73, 212, 0 },
-  { 174, 72, 0 },
-  { 52, 229, 0 },
-  { 132, -4, 0 },
-  { 27, 102, 0 },
-  { -3, 60, 0 },
-  { 196, 14, 0 },
-  { -28, 74, 0 },
-  { 59, 27, 0 },
-  { 58, 160, 0 },
-  { 109, 204, 0 },
-  { 91, 41, 0 },
-  { 137, 61, 0 },
-  { 54, 14, 0 },
-  { 23, 63, 0 },
-  { 35, 22, 0 },
-  { 159, -21, 0 },
-  { 136, 43, 0 },
-  { 193, -13, 0 },
-  { -19, 110, 0 },
-  { 164, 122, 0 },
-  { 225, 116, 0 },
-  { -8, 85, 0 },
-  { 97, 6, 0 },
-  { 44, 133, 0 },
-  { -4, 205, 0 },
-  { 207, -17, 1 },
-  { 48, 15, 1 },
-  { 7, 183, 1 },
-  { 227, 218, 1 },
-  { 152, 217, 1 },
-  { 45, 59, 1 },
-  { 66, 96, 1 },
-  { 98, 103, 1 },
-  { 96, -18, 1 },
-  { 54, 140, 1 },
-  { 0, 107, 1 },
-  { 164, 151, 1 },
-  { 152, 97, 1 },
-  { 129, 132, 1 },
-  { 8, 165, 1 },
-  { 13, 50, 1 },
-  { 43, 92, 1 },
-  { 218, 110, 1 },
-  { -8, -23, 1 },
-  { 176, 164, 1 },
-  { -29, 202, 1 },
-  { 208, 203, 1 },
-  { 177, 100, 1 },
-  { 149, 224, 1 },
-  { 184, 197, 1 },
-  { 110, 207, 1 },
-  { 7, -10, 1 },
-  { 127, 219, 1 },
-  { 22, 168, 1 },
-  { 158, 180, 1 },
-  { -7, 8, 1 },
-  { 34, 98, 1 },
-  { 62, -3, 1 },
-  { 39, 105, 1 },
-  { 16, 20, 1 },
-  { 25, 127, 1 },
-  { 147, 18, 1 },
-  { -3, 36, 1 },
-  { 208, 12, 1 },
-  { 9, 132, 1 },
-  { -14, -26, 1 },
-  { 69, 181, 1 },
-  { 206, 98, 1 },
-  { 118, 120, 1 },
-  { 175, 79, 1 },
-  { 214, 109, 1 },
-  { 24, 54, 1 },
-  { 1, 25, 1 },
-  { 73, 121, 1 },
-  { 216, -26, 1 },
-  { 54, 90, 1 },
-  { 193, 190, 1 },
-  { 197, 25, 1 },
-  { 84, 196, 1 },
-  { 76, 158, 1 },
-  { 47, -30, 1 },
-  { 64, 125, 1 },
-  { 31, 36, 1 },
-  { 229, -27, 1 },
-  { -24, 205, 1 },
-  { 46, 11, 1 },
-  { 198, 131, 1 },
-  { 183, 108, 1 },
-  { 38, 116, 1 },
-  { 40, 37, 1 },
-  { 102, 120, 1 },
-  { 198, 160, 1 },
-  { 88, 170, 1 },
-  { 45, 198, 1 },
-  { 3, 202, 1 },
-  { 201, 208, 1 },
-  { 142, 69, 1 },
-  { 56, 6, 1 },
-  { 213, 61, 1 },
-  { 16, 159, 1 },
-  { 160, 8, 1 },
-  { 68, 80, 1 },
-  { 225, 125, 1 },
-  { 124, 4, 1 },
-  { 195, 128, 1 },
-  { 68, 37, 1 },
-  { 228, 193, 1 },
-  { 129, 68, 1 },
-  { 167, 100, 1 },
-  { 115, -6, 1 },
-  { -9, 3, 1 },
-  { 50, 43, 1 },
-  { 229, 111, 1 },
-  { 228, 192, 1 },
-  { 101, 222, 1 },
-  { 9, 165, 1 },
-  { 171, 159, 1 },
-  { 25, 220, 1 },
-  { 59, 68, 1 },
-  { 37, 190, 1 },
-  { 161, 61, 1 },
-  { 111, 189, 1 },
-  { -18, 26, 1 },
-  { 107, 169, 1 },
-  { 29, 193, 1 },
-  { -23, 97, 1 },
-  { 146, 129, 1 },
-  { -10, 116, 1 },
-  { 189, 207, 1 },
-  { -18, 43, 1 },
-  { 9, 212, 1 },
-  { 184, -10, 1 },
-  { 53, 110, 1 },
-  { 155, 96, 1 },
-  { 77, 87, 1 },
-  { 94, 144, 1 },
-  { 189, 180, 1 },
-  { -18, 55, 1 },
-  { 175, 142, 1 },
-  { 225, -28, 1 },
-  { 80, 74, 1 },
-  { 156, 14, 1 },
-  { 138, 222, 1 },
-  { 78, -16, 1 },
-  { 148, 61, 1 },
-  { 221, 197, 1 },
-  { 132, 175, 1 },
-  { -26, 204, 1 },
-  { 25, -24, 1 },
-  { 50, 139, 1 },
-  { 22, 214, 1 },
-  { 15, 204, 1 },
-  { 93, 101, 1 },
-  { -2, 167, 1 },
-  { 151, 80, 1 },
-  { 122, 153, 1 },
-  { 185, 84, 1 },
-  { 23, 221, 1 },
-  { 79, 222, 1 },
-  { 194, 138, 1 },
-  { 198, 222, 1 },
-  { 92, -8, 1 },
-  { 25, -20, 1 },
-  { 32, 174, 1 },
-  { -3, 31, 1 },
-  { 190, 79, 1 },
-  { -18, 23, 1 },
-  { 24, 210, 1 },
-  { 7, 213, 1 },
-  { 184, 109, 1 },
-  { 46, 116, 1 },
-  { 44, 198, 1 },
-  { 202, 31, 1 },
-  { 90, 15, 1 },
-  { 119, 7, 1 },
-  { 4, 149, 1 },
-  { 202, 185, 1 },
-  { 76, 159, 1 },
-  { 187, 36, 1 },
-  { 207, 126, 1 },
-  { 61, 14, 1 },
-  { 149, 108, 1 },
-  { 93, 95, 1 },
-  { 57, 89, 1 },
-  { -13, 91, 1 },
-  { 14, 18, 1 },
-  { 132, 164, 1 },
-  { 186, 188, 1 },
-  { 102, 104, 1 },
-  { 205, 223, 1 },
-  { 38, 110, 1 },
-  { 11, 205, 1 },
-  { 145, 155, 1 },
-  { 197, -3, 1 },
-  { 43, 140, 1 },
-  { 107, 35, 1 },
-  { 142, 155, 2 },
-  { 13, 79, 2 },
-  { 148, 18, 2 },
-  { 204, 104, 2 },
-  { 198, 143, 2 },
-  { 152, 221, 2 },
-  { 96, 184, 2 },
-  { -25, 225, 2 },
+// x offset << 9 | y offset << 2 | radius, offsets from the anchor of the bin
+const uint16_t STARS[] PROGMEM = {
+  0x0204, 0x4620, 0x3a18, 0x0004, 0x4c24, 0x5621, 0x0204, 0x0004, 0x3e60, 0x0200,
+  0x4084, 0x0204, 0x3c70, 0x3679, 0x0001, 0x1030, 0x0608, 0x1238, 0x0200, 0x0a24,
+  0x1e70, 0x28a4, 0x0001, 0x1664, 0x1a68, 0x0204, 0x0604, 0x0220, 0x0208, 0x0474,
+  0x0401, 0x0400, 0x0234, 0x0001, 0x0804, 0x0044, 0x0038, 0x0e00, 0x0084, 0x2805,
+  0x142c, 0x0454, 0x0250, 0x1c28, 0x2a00, 0x0205, 0x0e00, 0x001d, 0x0000, 0x0004,
+  0x0008, 0x0201, 0x241c, 0x1618, 0x001c, 0x5a05, 0x0204, 0x0200, 0x2814, 0x0004,
+  0x1c19, 0x0a04, 0x0009, 0x0605, 0x0000, 0x0c10, 0x100c, 0x1a15, 0x0000, 0x1810,
+  0x2024, 0x3434, 0x1819, 0x4a55, 0x3248, 0x0201, 0x2a50, 0x0000, 0x1010, 0x0004,
+  0x1831, 0x040c, 0x1a50, 0x0200, 0x0a24, 0x0004, 0x165c, 0x0004, 0x0004, 0x1060,
+  0x0200, 0x0404, 0x0440, 0x023c, 0x0084, 0x0400, 0x0054, 0x0420, 0x0800, 0x0258,
+  0x1004, 0x0204, 0x0000, 0x0254, 0x1c04, 0x2004, 0x1214, 0x0244, 0x1c00, 0x1a18,
+  0x0e19, 0x3808, 0x2e28, 0x0268, 0x3e0c, 0x4805, 0x0200, 0x1400, 0x0608, 0x020c,
+  0x1408, 0x0204, 0x1e04, 0x0208, 0x1405, 0x0201, 0x0004, 0x1818, 0x0200, 0x1808,
+  0x1000, 0x1a14, 0x000c, 0x1a34, 0x0005, 0x0000, 0x0000, 0x0e15, 0x0816, 0x0c0c,
+  0x0204, 0x0204, 0x1634, 0x1029, 0x0418, 0x0005, 0x0a04, 0x0220, 0x0830, 0x0600,
+  0x0224, 0x0a25, 0x001c, 0x061c, 0x0c04, 0x0414, 0x0604, 0x0049, 0x0000, 0x0800,
+  0x0019, 0x001d, 0x080c, 0x0600, 0x0010, 0x0200, 0x0600, 0x0200, 0x0809, 0x0005,
+  0x1604, 0x040c, 0x0229, 0x0e08, 0x0608, 0x0200, 0x0208, 0x1401, 0x2401, 0x0200,
+  0x0009, 0x200c, 0x2408, 0x2804, 0x2a04, 0x0208, 0x1a15, 0x0210, 0x240c, 0x1400,
+  0x1011, 0x0004, 0x2614, 0x1e19, 0x0810, 0x0204, 0x0204, 0x1814, 0x0a00, 0x020d,
+  0x0004, 0x0005, 0x0204, 0x0618, 0x1034, 0x103c, 0x0204, 0x0618, 0x001d, 0x0204,
+  0x0624, 0x0810, 0x0200, 0x0a34, 0x000c, 0x0804, 0x0424, 0x0a04, 0x0a00, 0x0a44,
+  0x0240, 0x1014, 0x0a00, 0x021d, 0x0200, 0x0804, 0x024c, 0x0424, 0x0018, 0x0804,
+  0x141c, 0x2200, 0x0234, 0x1000, 0x000d, 0x0004, 0x0a05, 0x0000, 0x0201, 0x0604,
+  0x060c, 0x0408, 0x020c, 0x1e08, 0x2208, 0x2000, 0x2208, 0x000c, 0x0201, 0x2224,
+  0x2c1c, 0x0201, 0x0e21, 0x1610, 0x1a18, 0x1c20, 0x0005, 0x0204, 0x1211, 0x0000,
+  0x2a20, 0x1018, 0x0200, 0x1018, 0x2428, 0x1c24, 0x0a29, 0x0200, 0x101c, 0x1410,
+  0x0005, 0x1839, 0x0e25, 0x0004, 0x0a38, 0x1838, 0x0a00, 0x0008, 0x0604, 0x2038,
+  0x0220, 0x2039, 0x0618, 0x1220, 0x0000, 0x062c, 0x0005, 0x0c20, 0x0400, 0x0225,
+  0x0200, 0x0620, 0x0028, 0x0802, 0x0200, 0x0844, 0x0039, 0x0004, 0x0200, 0x0e18,
+  0x082c, 0x0054, 0x0a0c, 0x022d, 0x1a04, 0x0034, 0x1808, 0x1204, 0x1400, 0x0234,
+  0x0048, 0x1804, 0x1218, 0x0030, 0x1604, 0x122c, 0x020c, 0x0004, 0x021c, 0x021c,
+  0x2400, 0x1600, 0x0018, 0x0e2c, 0x060c, 0x2404, 0x2205, 0x0219, 0x1424, 0x2c08,
+  0x1c04, 0x0018, 0x121c, 0x1614, 0x000c, 0x1e00, 0x2204, 0x0018, 0x0400, 0x2604,
+  0x041c, 0x0200, 0x080c, 0x0c10, 0x0004, 0x200c, 0x240c, 0x0204, 0x2404, 0x1206,
+  0x0000, 0x1e10, 0x141c, 0x1c20, 0x1a08, 0x0200, 0x160c, 0x0000, 0x122c, 0x2434,
+  0x0831, 0x0224, 0x1e30, 0x1c48, 0x0600, 0x1c10, 0x0200, 0x1a34, 0x0a11, 0x1c15,
+  0x0204, 0x0c10, 0x124c, 0x0005, 0x0e38, 0x0a1c, 0x0a34, 0x0000, 0x0e01, 0x141c,
+  0x161c, 0x0200, 0x161c, 0x1a3c, 0x0204, 0x0808, 0x1025, 0x0248, 0x0044, 0x0604,
+  0x0a18, 0x021c, 0x0a05, 0x0250, 0x1028, 0x0c01, 0x0e00, 0x0004, 0x0810, 0x0018,
+  0x0e01, 0x0002, 0x022c, 0x1a04, 0x1000, 0x0018, 0x0204, 0x1200, 0x0204, 0x0004,
+  0x0214, 0x0000, 0x0000, 0x0000, 0x1604, 0x0205, 0x2005, 0x0014, 0x0601, 0x001c,
+  0x1804, 0x200c, 0x2220, 0x0c08, 0x2404, 0x0014, 0x0e10, 0x2019, 0x1815, 0x0402,
+  0x2c18, 0x0000, 0x1620, 0x1004, 0x0015, 0x1201, 0x020c, 0x1400, 0x1a10, 0x1a10,
+  0x0011, 0x0826, 0x0000, 0x0e08, 0x1c28, 0x2e1c, 0x0204, 0x2810, 0x2210, 0x2009,
+  0x160c, 0x0010, 0x183c, 0x0c00, 0x2420, 0x1239, 0x0004, 0x1c39, 0x2234, 0x0204,
+  0x0c20, 0x0024, 0x0600, 0x0000, 0x0e10, 0x1c30, 0x0204, 0x1824, 0x1830, 0x0618,
+  0x0200, 0x0235, 0x0204, 0x0848, 0x0a04, 0x0418, 0x0e08, 0x1210, 0x141d, 0x0259,
+  0x0648, 0x0004, 0x1234, 0x0200, 0x0239, 0x0200, 0x0a20, 0x1014, 0x160c, 0x1600,
+  0x0208, 0x0c00, 0x0c04, 0x1010, 0x0219, 0x0019, 0x021c, 0x0c0c, 0x0830, 0x0e04,
+  0x1c08, 0x0c44, 0x0a01, 0x1604, 0x1c00, 0x0030, 0x0a35, 0x221c, 0x0224, 0x1200,
+  0x103c, 0x1c08, 0x2c01, 0x0014, 0x2c01, 0x1404, 0x1020, 0x1e04, 0x1a1c, 0x142d,
+  0x2415, 0x162d, 0x0035, 0x2008, 0x1214, 0x020c, 0x1200, 0x040c, 0x1005, 0x0c08,
+  0x1214, 0x0000, 0x0800, 0x0004, 0x0e1c, 0x002c, 0x1604, 0x1409, 0x1a0c, 0x1a04,
+  0x1200, 0x1818, 0x0000, 0x0218, 0x280d, 0x1618, 0x1008, 0x021d, 0x1605, 0x0204,
+  0x101c, 0x1004, 0x0218, 0x1c0c, 0x020c, 0x1200, 0x0214, 0x1601, 0x0219, 0x0205,
+  0x021c, 0x0e04, 0x0c18, 0x0409, 0x0001, 0x1620, 0x0204, 0x1c44, 0x1208, 0x2240,
+  0x021c, 0x0c00, 0x041c, 0x1220, 0x0c14, 0x1835, 0x0204, 0x1008, 0x1831, 0x0e1c,
+  0x0414, 0x0004, 0x1440, 0x101d, 0x101c, 0x0c04, 0x0620, 0x1240, 0x0034, 0x0001,
+  0x123c, 0x0008, 0x0e18, 0x0c40, 0x1001, 0x0829, 0x0004, 0x0458, 0x0218, 0x1208,
+  0x0400, 0x0024, 0x1248, 0x0641, 0x0204, 0x0a30, 0x0c40, 0x0a04, 0x0040, 0x140c,
+  0x1c00, 0x0a00, 0x0821, 0x0039, 0x1e00, 0x002c, 0x0014, 0x1000, 0x0000, 0x1214,
+  0x0230, 0x1e05, 0x0a31, 0x0024, 0x2614, 0x0e34, 0x2405, 0x0e0c, 0x0034, 0x2000,
+  0x1200, 0x0020, 0x0c18, 0x1a1d, 0x0e1c, 0x0e04, 0x0224, 0x2408, 0x0e14, 0x0604,
+  0x000c, 0x0a24, 0x0404, 0x0204, 0x0c21, 0x001c, 0x0a04, 0x0a2d, 0x0604, 0x0208,
+  0x022d, 0x0000, 0x0200, 0x0418, 0x0a04, 0x0018, 0x0614, 0x1004, 0x0420, 0x121c,
+  0x0010, 0x0e04, 0x0015, 0x100c, 0x0814, 0x0014, 0x1034, 0x0410, 0x0201, 0x0e30,
+  0x0438, 0x040c, 0x0005, 0x0a2d, 0x1034, 0x0618, 0x0004, 0x0c28, 0x1a44, 0x0e00,
+  0x023c, 0x0a24, 0x0a0c, 0x0620, 0x1844, 0x0805, 0x0221, 0x0816, 0x0c0c, 0x101c,
+  0x0224, 0x0620, 0x1a18, 0x1204, 0x1811, 0x0204, 0x0200, 0x0200, 0x0e00, 0x1620,
+  0x0018, 0x0400, 0x083c, 0x0a00, 0x0004, 0x0a04, 0x0629, 0x0011, 0x022d, 0x0401,
+  0x0628, 0x0a50, 0x1004, 0x1a10, 0x0a29, 0x022d, 0x0201, 0x0004, 0x1400, 0x1e15,
+  0x1004, 0x0020, 0x1e24, 0x221c, 0x0210, 0x080c, 0x0a04, 0x0004, 0x0000, 0x0204,
+  0x0004, 0x0000, 0x022c, 0x0c0c, 0x0030, 0x0000, 0x0005, 0x0400, 0x1c38, 0x1a1c,
+  0x0224, 0x142d, 0x0018, 0x0011, 0x0005, 0x0201, 0x1245, 0x041c, 0x0200, 0x1404,
+  0x1a2c, 0x0209, 0x0e08, 0x0e2c, 0x0808, 0x0030, 0x0020, 0x0601, 0x0004, 0x141c,
+  0x1010, 0x1e20, 0x0a24, 0x0201, 0x0208, 0x0804, 0x0e04, 0x0208, 0x0000, 0x1610,
+  0x020c, 0x1800, 0x020c, 0x0204, 0x0004, 0x1c14, 0x0e08, 0x0404, 0x0018, 0x0c1c,
+  0x0238, 0x0244, 0x0c20, 0x0809, 0x0610, 0x0200, 0x0020, 0x020d, 0x1e1c, 0x0008,
+  0x1801, 0x0a00, 0x021c, 0x0224, 0x0e20, 0x1a00, 0x1600, 0x0018, 0x0204, 0x0004,
 };
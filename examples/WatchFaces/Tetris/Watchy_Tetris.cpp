@@ -5,8 +5,7 @@ const unsigned char *tetris_nums [10] = {tetris0, tetris1, tetris2, tetris3, tet
 WatchyTetris::WatchyTetris(){} //constructor
 
 void WatchyTetris::drawWatchFace(){
-    display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, tetrisbg, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+    display.drawBitmapRLE(0, 0, tetrisbg_rle, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK, GxEPD_WHITE);
 
     //Hour
     display.drawBitmap(25, 20, tetris_nums[currentTime.Hour/10], 40, 60, GxEPD_BLACK); //first digit
@@ -1,536 +1,395 @@
-// 'dither_it_tetris_0', 40x60px
+// Generated by tools/assetgen.py from assets.json, do not edit. 5732 bytes of PROGMEM
+// 'tetris0', 40x60px
 const unsigned char tetris0 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0, 
-	0xf0, 0x3d, 0xd7, 0x75, 0x8b, 0x62, 0xd9, 0xce, 0xb3, 0xc3, 0x70, 0xdc, 0xee, 0x7b, 0xbf, 0x6f, 
-	0xda, 0x87, 0x21, 0xad, 0x6b, 0x59, 0x2e, 0x97, 0xd2, 0xf4, 0xbd, 0x57, 0x53, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x6a, 0xba, 0xae, 0xa5, 0xa4, 0xf0, 0x1c, 0x07, 
-	0x13, 0xb2, 0xe0, 0x58, 0x16, 0x55, 0xc9, 0x72, 0xdc, 0xb7, 0x73, 0xc4, 0xe0, 0xd8, 0x36, 0x79, 
-	0xaa, 0xff, 0xdf, 0xf7, 0x13, 0xd5, 0x66, 0xb9, 0xae, 0xa5, 0xa4, 0xf2, 0xbc, 0xaf, 0x55, 0x92, 
-	0x7f, 0xff, 0xff, 0xff, 0xd9, 0xc0, 0x00, 0x03, 0xff, 0xc4, 0xc0, 0x00, 0x02, 0x93, 0xd5, 0x40, 
-	0x00, 0x02, 0x49, 0x95, 0xc0, 0x00, 0x03, 0x25, 0xd0, 0x40, 0x00, 0x02, 0xbb, 0xa5, 0xc0, 0x00, 
-	0x03, 0x73, 0xda, 0xc0, 0x00, 0x02, 0x29, 0xc9, 0x40, 0x00, 0x03, 0x45, 0xa5, 0x40, 0x00, 0x02, 
-	0xab, 0xb0, 0xc0, 0x00, 0x03, 0xff, 0xcd, 0xc0, 0x00, 0x03, 0xff, 0xd2, 0x40, 0x00, 0x03, 0x25, 
-	0xa4, 0xc0, 0x00, 0x02, 0xdb, 0xca, 0xc0, 0x00, 0x02, 0xfd, 0xb2, 0xc0, 0x00, 0x03, 0x4b, 0x89, 
-	0x40, 0x00, 0x02, 0xcd, 0xea, 0xc0, 0x00, 0x02, 0xfd, 0xc9, 0x40, 0x00, 0x03, 0x55, 0xa5, 0x40, 
-	0x00, 0x02, 0xab, 0xb2, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x7f, 0xff, 0xff, 0xff, 0x94, 0xf5, 0x5d, 
-	0x57, 0x25, 0xd2, 0xea, 0xba, 0xae, 0xdb, 0xca, 0x6f, 0xdb, 0xf6, 0xfd, 0xa9, 0x74, 0xdd, 0x37, 
-	0x4b, 0xd5, 0xec, 0xbb, 0x2e, 0xcd, 0xc4, 0xef, 0xdb, 0xf6, 0xfb, 0xaa, 0x75, 0x5d, 0x57, 0x59, 
-	0xd5, 0xea, 0xba, 0xae, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 
-	0x7b, 0x7e, 0xde, 0x93, 0xd6, 0xed, 0xbb, 0x6e, 0xed, 0xdb, 0xf6, 0xfd, 0xbe, 0xfb, 0xed, 0x7b, 
-	0x5e, 0xd6, 0xcd, 0xdb, 0xf6, 0xfb, 0x7e, 0xcb, 0xed, 0x7b, 0x5e, 0xd7, 0x7d, 0xb7, 0xed, 0xfd, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0,
+	0xf0, 0x3d, 0xd7, 0x75, 0x8b, 0x62, 0xd9, 0xce, 0xb3, 0xc3, 0x70, 0xdc, 0xee, 0x7b, 0xbf, 0x6f,
+	0xda, 0x87, 0x21, 0xad, 0x6b, 0x59, 0x2e, 0x97, 0xd2, 0xf4, 0xbd, 0x57, 0x53, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x6a, 0xba, 0xae, 0xa5, 0xa4, 0xf0, 0x1c, 0x07,
+	0x13, 0xb2, 0xe0, 0x58, 0x16, 0x55, 0xc9, 0x72, 0xdc, 0xb7, 0x73, 0xc4, 0xe0, 0xd8, 0x36, 0x79,
+	0xaa, 0xff, 0xdf, 0xf7, 0x13, 0xd5, 0x66, 0xb9, 0xae, 0xa5, 0xa4, 0xf2, 0xbc, 0xaf, 0x55, 0x92,
+	0x7f, 0xff, 0xff, 0xff, 0xd9, 0xc0, 0x00, 0x03, 0xff, 0xc4, 0xc0, 0x00, 0x02, 0x93, 0xd5, 0x40,
+	0x00, 0x02, 0x49, 0x95, 0xc0, 0x00, 0x03, 0x25, 0xd0, 0x40, 0x00, 0x02, 0xbb, 0xa5, 0xc0, 0x00,
+	0x03, 0x73, 0xda, 0xc0, 0x00, 0x02, 0x29, 0xc9, 0x40, 0x00, 0x03, 0x45, 0xa5, 0x40, 0x00, 0x02,
+	0xab, 0xb0, 0xc0, 0x00, 0x03, 0xff, 0xcd, 0xc0, 0x00, 0x03, 0xff, 0xd2, 0x40, 0x00, 0x03, 0x25,
+	0xa4, 0xc0, 0x00, 0x02, 0xdb, 0xca, 0xc0, 0x00, 0x02, 0xfd, 0xb2, 0xc0, 0x00, 0x03, 0x4b, 0x89,
+	0x40, 0x00, 0x02, 0xcd, 0xea, 0xc0, 0x00, 0x02, 0xfd, 0xc9, 0x40, 0x00, 0x03, 0x55, 0xa5, 0x40,
+	0x00, 0x02, 0xab, 0xb2, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x7f, 0xff, 0xff, 0xff, 0x94, 0xf5, 0x5d,
+	0x57, 0x25, 0xd2, 0xea, 0xba, 0xae, 0xdb, 0xca, 0x6f, 0xdb, 0xf6, 0xfd, 0xa9, 0x74, 0xdd, 0x37,
+	0x4b, 0xd5, 0xec, 0xbb, 0x2e, 0xcd, 0xc4, 0xef, 0xdb, 0xf6, 0xfb, 0xaa, 0x75, 0x5d, 0x57, 0x59,
+	0xd5, 0xea, 0xba, 0xae, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+	0x7b, 0x7e, 0xde, 0x93, 0xd6, 0xed, 0xbb, 0x6e, 0xed, 0xdb, 0xf6, 0xfd, 0xbe, 0xfb, 0xed, 0x7b,
+	0x5e, 0xd6, 0xcd, 0xdb, 0xf6, 0xfb, 0x7e, 0xcb, 0xed, 0x7b, 0x5e, 0xd7, 0x7d, 0xb7, 0xed, 0xfd,
 	0xbe, 0xd5, 0xed, 0x7b, 0x5f, 0x6f, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-// 'dither_it_tetris_1', 40x60px
+// 'tetris1', 40x60px
 const unsigned char tetris1 [] PROGMEM = {
-	0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x57, 0x55, 0x00, 0x00, 0x09, 0x56, 0x03, 0x00, 
-	0x00, 0x0d, 0x1f, 0x75, 0x00, 0x00, 0x08, 0xa6, 0xb3, 0x00, 0x00, 0x0e, 0x4e, 0x7b, 0x00, 0x00, 
-	0x0a, 0xaf, 0x21, 0x00, 0x00, 0x0d, 0x56, 0x97, 0x00, 0x00, 0x0a, 0x4f, 0x53, 0x00, 0x00, 0x09, 
-	0x27, 0xff, 0x00, 0x00, 0x0c, 0x9f, 0xff, 0x00, 0x00, 0x0d, 0x4e, 0xa5, 0x00, 0x00, 0x0c, 0xae, 
-	0x13, 0x00, 0x00, 0x0a, 0x57, 0x55, 0x00, 0x00, 0x0b, 0x2e, 0xb3, 0x00, 0x00, 0x0c, 0x96, 0x79, 
-	0x00, 0x00, 0x0d, 0x4f, 0x25, 0x00, 0x00, 0x0a, 0xae, 0x93, 0x00, 0x00, 0x0c, 0x27, 0x55, 0x00, 
-	0x00, 0x0b, 0x57, 0xff, 0x00, 0x00, 0x09, 0x9f, 0xff, 0x00, 0x00, 0x0c, 0x46, 0xab, 0x00, 0x00, 
-	0x0d, 0x5f, 0x03, 0x00, 0x00, 0x0a, 0x4e, 0x75, 0x00, 0x00, 0x0b, 0x27, 0x33, 0x00, 0x00, 0x0c, 
-	0x9e, 0xb9, 0x00, 0x00, 0x0c, 0xae, 0x55, 0x00, 0x00, 0x0a, 0xa7, 0x23, 0x00, 0x00, 0x0d, 0x2e, 
-	0xab, 0x00, 0x00, 0x0a, 0x97, 0xff, 0x00, 0x00, 0x09, 0x2f, 0xff, 0x00, 0x00, 0x0c, 0x97, 0x25, 
-	0x00, 0x00, 0x0d, 0x56, 0xdb, 0x00, 0x00, 0x0c, 0xae, 0xfd, 0x00, 0x00, 0x0a, 0x8e, 0xcb, 0x00, 
-	0x00, 0x0d, 0x5e, 0xcd, 0x00, 0x00, 0x0c, 0x47, 0x7d, 0x00, 0x00, 0x0a, 0xae, 0xd5, 0x00, 0x00, 
-	0x0d, 0x57, 0x2b, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 
-	0xbe, 0x93, 0x00, 0x00, 0x0d, 0x6e, 0xed, 0x00, 0x00, 0x0d, 0xb6, 0xfb, 0x00, 0x00, 0x0e, 0xdf, 
-	0x4d, 0x00, 0x00, 0x0b, 0x6e, 0xcb, 0x00, 0x00, 0x0e, 0xde, 0xfd, 0x00, 0x00, 0x0d, 0xb7, 0x55, 
-	0x00, 0x00, 0x0f, 0x7e, 0xab, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
-	0x00, 0x0a, 0x96, 0x93, 0x00, 0x00, 0x0c, 0x0e, 0xed, 0x00, 0x00, 0x08, 0x0e, 0xfb, 0x00, 0x00, 
-	0x0c, 0xb6, 0xcd, 0x00, 0x00, 0x08, 0x37, 0x4b, 0x00, 0x00, 0x0f, 0xf6, 0xfd, 0x00, 0x00, 0x09, 
+	0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x57, 0x55, 0x00, 0x00, 0x09, 0x56, 0x03, 0x00,
+	0x00, 0x0d, 0x1f, 0x75, 0x00, 0x00, 0x08, 0xa6, 0xb3, 0x00, 0x00, 0x0e, 0x4e, 0x7b, 0x00, 0x00,
+	0x0a, 0xaf, 0x21, 0x00, 0x00, 0x0d, 0x56, 0x97, 0x00, 0x00, 0x0a, 0x4f, 0x53, 0x00, 0x00, 0x09,
+	0x27, 0xff, 0x00, 0x00, 0x0c, 0x9f, 0xff, 0x00, 0x00, 0x0d, 0x4e, 0xa5, 0x00, 0x00, 0x0c, 0xae,
+	0x13, 0x00, 0x00, 0x0a, 0x57, 0x55, 0x00, 0x00, 0x0b, 0x2e, 0xb3, 0x00, 0x00, 0x0c, 0x96, 0x79,
+	0x00, 0x00, 0x0d, 0x4f, 0x25, 0x00, 0x00, 0x0a, 0xae, 0x93, 0x00, 0x00, 0x0c, 0x27, 0x55, 0x00,
+	0x00, 0x0b, 0x57, 0xff, 0x00, 0x00, 0x09, 0x9f, 0xff, 0x00, 0x00, 0x0c, 0x46, 0xab, 0x00, 0x00,
+	0x0d, 0x5f, 0x03, 0x00, 0x00, 0x0a, 0x4e, 0x75, 0x00, 0x00, 0x0b, 0x27, 0x33, 0x00, 0x00, 0x0c,
+	0x9e, 0xb9, 0x00, 0x00, 0x0c, 0xae, 0x55, 0x00, 0x00, 0x0a, 0xa7, 0x23, 0x00, 0x00, 0x0d, 0x2e,
+	0xab, 0x00, 0x00, 0x0a, 0x97, 0xff, 0x00, 0x00, 0x09, 0x2f, 0xff, 0x00, 0x00, 0x0c, 0x97, 0x25,
+	0x00, 0x00, 0x0d, 0x56, 0xdb, 0x00, 0x00, 0x0c, 0xae, 0xfd, 0x00, 0x00, 0x0a, 0x8e, 0xcb, 0x00,
+	0x00, 0x0d, 0x5e, 0xcd, 0x00, 0x00, 0x0c, 0x47, 0x7d, 0x00, 0x00, 0x0a, 0xae, 0xd5, 0x00, 0x00,
+	0x0d, 0x57, 0x2b, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f,
+	0xbe, 0x93, 0x00, 0x00, 0x0d, 0x6e, 0xed, 0x00, 0x00, 0x0d, 0xb6, 0xfb, 0x00, 0x00, 0x0e, 0xdf,
+	0x4d, 0x00, 0x00, 0x0b, 0x6e, 0xcb, 0x00, 0x00, 0x0e, 0xde, 0xfd, 0x00, 0x00, 0x0d, 0xb7, 0x55,
+	0x00, 0x00, 0x0f, 0x7e, 0xab, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00,
+	0x00, 0x0a, 0x96, 0x93, 0x00, 0x00, 0x0c, 0x0e, 0xed, 0x00, 0x00, 0x08, 0x0e, 0xfb, 0x00, 0x00,
+	0x0c, 0xb6, 0xcd, 0x00, 0x00, 0x08, 0x37, 0x4b, 0x00, 0x00, 0x0f, 0xf6, 0xfd, 0x00, 0x00, 0x09,
 	0xae, 0xab, 0x00, 0x00, 0x0c, 0xaf, 0x55, 0x00, 0x00, 0x0f, 0xff, 0xff
 };
-// 'dither_it_tetris_2', 40x60px
+// 'tetris2', 40x60px
 const unsigned char tetris2 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0, 
-	0xf0, 0x3c, 0x0f, 0x75, 0x8b, 0x62, 0xd8, 0xb6, 0x73, 0xc3, 0x70, 0xdc, 0x37, 0x3b, 0xbf, 0x6f, 
-	0xdb, 0xf6, 0xa1, 0xad, 0x6b, 0x5a, 0xd6, 0x4b, 0xd2, 0xf4, 0xbd, 0x2f, 0x55, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x6a, 0xba, 0xae, 0xab, 0xb6, 0xf0, 0x18, 0x07, 
-	0x03, 0xbf, 0x60, 0x5d, 0xde, 0x75, 0xd2, 0xf2, 0xda, 0xc7, 0x33, 0xb3, 0x60, 0xdd, 0xee, 0xb9, 
-	0xbf, 0x7f, 0xd8, 0x4e, 0x55, 0xd5, 0x66, 0xbd, 0x27, 0x23, 0xaa, 0xf2, 0xba, 0xae, 0xab, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x53, 0x00, 0x00, 
-	0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x03, 0x65, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x00, 0x00, 0x00, 
-	0x02, 0x73, 0x00, 0x00, 0x00, 0x03, 0x29, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x03, 
-	0x77, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x13, 
-	0x80, 0xe0, 0x3a, 0xae, 0xe9, 0xc0, 0xf7, 0x5b, 0xf6, 0xff, 0x8b, 0x67, 0x3b, 0x36, 0xc9, 0xc3, 
-	0x73, 0xbb, 0x2f, 0x4f, 0xbf, 0x6a, 0x1d, 0xf6, 0xf9, 0xad, 0x64, 0xbb, 0x56, 0xad, 0xd2, 0xf5, 
-	0x5c, 0xaf, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xd5, 0x72, 0x50, 
-	0x00, 0x00, 0x80, 0xed, 0xb0, 0x00, 0x00, 0xc0, 0x6f, 0xd0, 0x00, 0x00, 0x8b, 0xec, 0xb0, 0x00, 
-	0x00, 0xc3, 0x74, 0xd0, 0x00, 0x00, 0xbf, 0x6f, 0xd0, 0x00, 0x00, 0xad, 0x6a, 0xb0, 0x00, 0x00, 
-	0xd2, 0xf5, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 
-	0x69, 0x3d, 0x57, 0x55, 0x80, 0xee, 0xd8, 0x0e, 0xab, 0xc0, 0x6f, 0xbc, 0x0e, 0xfd, 0x8b, 0xec, 
-	0xd8, 0xb6, 0xcd, 0xc3, 0x74, 0xdc, 0x37, 0x4b, 0xbf, 0x6f, 0xbb, 0xf6, 0xfd, 0xad, 0x6a, 0xba, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0,
+	0xf0, 0x3c, 0x0f, 0x75, 0x8b, 0x62, 0xd8, 0xb6, 0x73, 0xc3, 0x70, 0xdc, 0x37, 0x3b, 0xbf, 0x6f,
+	0xdb, 0xf6, 0xa1, 0xad, 0x6b, 0x5a, 0xd6, 0x4b, 0xd2, 0xf4, 0xbd, 0x2f, 0x55, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x6a, 0xba, 0xae, 0xab, 0xb6, 0xf0, 0x18, 0x07,
+	0x03, 0xbf, 0x60, 0x5d, 0xde, 0x75, 0xd2, 0xf2, 0xda, 0xc7, 0x33, 0xb3, 0x60, 0xdd, 0xee, 0xb9,
+	0xbf, 0x7f, 0xd8, 0x4e, 0x55, 0xd5, 0x66, 0xbd, 0x27, 0x23, 0xaa, 0xf2, 0xba, 0xae, 0xab, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x53, 0x00, 0x00,
+	0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x03, 0x65, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x00, 0x00, 0x00,
+	0x02, 0x73, 0x00, 0x00, 0x00, 0x03, 0x29, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x03,
+	0x77, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x13,
+	0x80, 0xe0, 0x3a, 0xae, 0xe9, 0xc0, 0xf7, 0x5b, 0xf6, 0xff, 0x8b, 0x67, 0x3b, 0x36, 0xc9, 0xc3,
+	0x73, 0xbb, 0x2f, 0x4f, 0xbf, 0x6a, 0x1d, 0xf6, 0xf9, 0xad, 0x64, 0xbb, 0x56, 0xad, 0xd2, 0xf5,
+	0x5c, 0xaf, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xd5, 0x72, 0x50,
+	0x00, 0x00, 0x80, 0xed, 0xb0, 0x00, 0x00, 0xc0, 0x6f, 0xd0, 0x00, 0x00, 0x8b, 0xec, 0xb0, 0x00,
+	0x00, 0xc3, 0x74, 0xd0, 0x00, 0x00, 0xbf, 0x6f, 0xd0, 0x00, 0x00, 0xad, 0x6a, 0xb0, 0x00, 0x00,
+	0xd2, 0xf5, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+	0x69, 0x3d, 0x57, 0x55, 0x80, 0xee, 0xd8, 0x0e, 0xab, 0xc0, 0x6f, 0xbc, 0x0e, 0xfd, 0x8b, 0xec,
+	0xd8, 0xb6, 0xcd, 0xc3, 0x74, 0xdc, 0x37, 0x4b, 0xbf, 0x6f, 0xbb, 0xf6, 0xfd, 0xad, 0x6a, 0xba,
 	0xd7, 0x55, 0xd2, 0xf5, 0x5d, 0x2e, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-// 'dither_it_tetris_3', 40x60px
+// 'tetris3', 40x60px
 const unsigned char tetris3 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x55, 0x6b, 0x5a, 0xab, 0xa2, 0x29, 0x24, 0x49, 0x29, 0xc9, 
-	0x55, 0x4a, 0xa5, 0x4b, 0xa5, 0x8a, 0x33, 0x14, 0x25, 0xb4, 0x51, 0x88, 0xa9, 0xab, 0xc3, 0x14, 
-	0x56, 0x52, 0x53, 0x9a, 0x52, 0xa4, 0x95, 0x49, 0xd9, 0xd6, 0xd5, 0xb5, 0x5f, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x6a, 0xba, 0x97, 0x49, 0xb6, 0xe0, 0x1c, 0x4e, 
-	0x23, 0xbf, 0x70, 0x59, 0x57, 0x55, 0xd2, 0xe2, 0xdd, 0xce, 0x73, 0xb3, 0x70, 0xd9, 0xe7, 0x3b, 
-	0xbe, 0xef, 0xdc, 0x4e, 0xa5, 0xd6, 0x6b, 0x5a, 0x96, 0x49, 0xa9, 0xf4, 0xbd, 0x57, 0x57, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x53, 0x00, 0x00, 
-	0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x03, 0x65, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x00, 0x00, 0x00, 
-	0x02, 0x71, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x03, 
-	0x75, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x35, 0x5d, 0x57, 0x13, 
-	0x00, 0x20, 0x3a, 0xae, 0xed, 0x00, 0x37, 0x5b, 0xf6, 0xfb, 0x00, 0x2b, 0x3b, 0x36, 0xcd, 0x00, 
-	0x27, 0xbb, 0x2f, 0x4b, 0x00, 0x32, 0x1d, 0xf6, 0xfd, 0x00, 0x29, 0x7b, 0x56, 0xab, 0x00, 0x35, 
-	0x3c, 0xaf, 0x55, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 
-	0x02, 0x93, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x02, 
-	0xcb, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x02, 0xab, 
-	0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 
-	0x75, 0x5d, 0x57, 0x25, 0x80, 0xe0, 0x38, 0x0e, 0xdb, 0xc0, 0xf0, 0x3c, 0x0e, 0xfd, 0x8b, 0x62, 
-	0xd8, 0xb6, 0xcb, 0xc3, 0x70, 0xdc, 0x37, 0x4d, 0xbf, 0x6f, 0xdb, 0xf6, 0xfd, 0xad, 0x6b, 0x5a, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x55, 0x6b, 0x5a, 0xab, 0xa2, 0x29, 0x24, 0x49, 0x29, 0xc9,
+	0x55, 0x4a, 0xa5, 0x4b, 0xa5, 0x8a, 0x33, 0x14, 0x25, 0xb4, 0x51, 0x88, 0xa9, 0xab, 0xc3, 0x14,
+	0x56, 0x52, 0x53, 0x9a, 0x52, 0xa4, 0x95, 0x49, 0xd9, 0xd6, 0xd5, 0xb5, 0x5f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x6a, 0xba, 0x97, 0x49, 0xb6, 0xe0, 0x1c, 0x4e,
+	0x23, 0xbf, 0x70, 0x59, 0x57, 0x55, 0xd2, 0xe2, 0xdd, 0xce, 0x73, 0xb3, 0x70, 0xd9, 0xe7, 0x3b,
+	0xbe, 0xef, 0xdc, 0x4e, 0xa5, 0xd6, 0x6b, 0x5a, 0x96, 0x49, 0xa9, 0xf4, 0xbd, 0x57, 0x57, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x53, 0x00, 0x00,
+	0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x03, 0x65, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x00, 0x00, 0x00,
+	0x02, 0x71, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x03,
+	0x75, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x35, 0x5d, 0x57, 0x13,
+	0x00, 0x20, 0x3a, 0xae, 0xed, 0x00, 0x37, 0x5b, 0xf6, 0xfb, 0x00, 0x2b, 0x3b, 0x36, 0xcd, 0x00,
+	0x27, 0xbb, 0x2f, 0x4b, 0x00, 0x32, 0x1d, 0xf6, 0xfd, 0x00, 0x29, 0x7b, 0x56, 0xab, 0x00, 0x35,
+	0x3c, 0xaf, 0x55, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,
+	0x02, 0x93, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x02,
+	0xcb, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x02, 0xab,
+	0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
+	0x75, 0x5d, 0x57, 0x25, 0x80, 0xe0, 0x38, 0x0e, 0xdb, 0xc0, 0xf0, 0x3c, 0x0e, 0xfd, 0x8b, 0x62,
+	0xd8, 0xb6, 0xcb, 0xc3, 0x70, 0xdc, 0x37, 0x4d, 0xbf, 0x6f, 0xdb, 0xf6, 0xfd, 0xad, 0x6b, 0x5a,
 	0xd6, 0xab, 0xd2, 0xf4, 0xbd, 0x2f, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-// 'dither_it_tetris_4', 40x60px
+// 'tetris4', 40x60px
 const unsigned char tetris4 [] PROGMEM = {
-	0xff, 0xc0, 0x00, 0x03, 0xff, 0xd5, 0x40, 0x00, 0x03, 0xff, 0x80, 0xc0, 0x00, 0x03, 0x4b, 0xc0, 
-	0xc0, 0x00, 0x03, 0x77, 0x8b, 0x40, 0x00, 0x03, 0xad, 0xc3, 0x40, 0x00, 0x03, 0x77, 0xbf, 0x40, 
-	0x00, 0x03, 0xad, 0xad, 0x40, 0x00, 0x02, 0xf7, 0xd2, 0xc0, 0x00, 0x03, 0xaf, 0xff, 0xc0, 0x00, 
-	0x03, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x40, 0x00, 0x03, 0xbb, 0xb6, 0xc0, 0x00, 0x03, 
-	0x6f, 0xbf, 0x40, 0x00, 0x03, 0xb5, 0xd2, 0xc0, 0x00, 0x02, 0xdb, 0xb3, 0x40, 0x00, 0x03, 0xb7, 
-	0xbf, 0x40, 0x00, 0x03, 0x6d, 0xd5, 0x40, 0x00, 0x03, 0xb7, 0xaa, 0xc0, 0x00, 0x03, 0x7b, 0xff, 
-	0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf5, 0x5d, 0x57, 0xb7, 0x88, 0x60, 
-	0x38, 0x0f, 0x6d, 0xd5, 0xf0, 0x3c, 0x0f, 0xb7, 0x9c, 0x62, 0xd8, 0xb6, 0xdb, 0xce, 0xf0, 0xdc, 
-	0x37, 0x6f, 0xa9, 0x6f, 0xdb, 0xf7, 0xb5, 0x92, 0xeb, 0x5a, 0xd7, 0x6f, 0xd4, 0xf4, 0xbd, 0x2f, 
-	0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xe9, 0x5a, 0x4e, 0x4b, 
-	0x82, 0x64, 0x3b, 0xb7, 0x75, 0xd9, 0x73, 0x5b, 0xf6, 0xfd, 0xae, 0xeb, 0x3d, 0x2e, 0xcb, 0x9c, 
-	0xe7, 0x9b, 0x37, 0x4d, 0xca, 0x72, 0x5b, 0xee, 0xfb, 0xa1, 0x69, 0x3d, 0x66, 0xab, 0xdd, 0xf5, 
-	0x5a, 0x9f, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 
-	0x02, 0x93, 0x00, 0x00, 0x00, 0x02, 0xed, 0x00, 0x00, 0x00, 0x03, 0x7d, 0x00, 0x00, 0x00, 0x02, 
-	0xcb, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x03, 0x7b, 0x00, 0x00, 0x00, 0x02, 0xd9, 
-	0x00, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 
-	0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 
-	0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 
+	0xff, 0xc0, 0x00, 0x03, 0xff, 0xd5, 0x40, 0x00, 0x03, 0xff, 0x80, 0xc0, 0x00, 0x03, 0x4b, 0xc0,
+	0xc0, 0x00, 0x03, 0x77, 0x8b, 0x40, 0x00, 0x03, 0xad, 0xc3, 0x40, 0x00, 0x03, 0x77, 0xbf, 0x40,
+	0x00, 0x03, 0xad, 0xad, 0x40, 0x00, 0x02, 0xf7, 0xd2, 0xc0, 0x00, 0x03, 0xaf, 0xff, 0xc0, 0x00,
+	0x03, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x40, 0x00, 0x03, 0xbb, 0xb6, 0xc0, 0x00, 0x03,
+	0x6f, 0xbf, 0x40, 0x00, 0x03, 0xb5, 0xd2, 0xc0, 0x00, 0x02, 0xdb, 0xb3, 0x40, 0x00, 0x03, 0xb7,
+	0xbf, 0x40, 0x00, 0x03, 0x6d, 0xd5, 0x40, 0x00, 0x03, 0xb7, 0xaa, 0xc0, 0x00, 0x03, 0x7b, 0xff,
+	0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf5, 0x5d, 0x57, 0xb7, 0x88, 0x60,
+	0x38, 0x0f, 0x6d, 0xd5, 0xf0, 0x3c, 0x0f, 0xb7, 0x9c, 0x62, 0xd8, 0xb6, 0xdb, 0xce, 0xf0, 0xdc,
+	0x37, 0x6f, 0xa9, 0x6f, 0xdb, 0xf7, 0xb5, 0x92, 0xeb, 0x5a, 0xd7, 0x6f, 0xd4, 0xf4, 0xbd, 0x2f,
+	0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xe9, 0x5a, 0x4e, 0x4b,
+	0x82, 0x64, 0x3b, 0xb7, 0x75, 0xd9, 0x73, 0x5b, 0xf6, 0xfd, 0xae, 0xeb, 0x3d, 0x2e, 0xcb, 0x9c,
+	0xe7, 0x9b, 0x37, 0x4d, 0xca, 0x72, 0x5b, 0xee, 0xfb, 0xa1, 0x69, 0x3d, 0x66, 0xab, 0xdd, 0xf5,
+	0x5a, 0x9f, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,
+	0x02, 0x93, 0x00, 0x00, 0x00, 0x02, 0xed, 0x00, 0x00, 0x00, 0x03, 0x7d, 0x00, 0x00, 0x00, 0x02,
+	0xcb, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x03, 0x7b, 0x00, 0x00, 0x00, 0x02, 0xd9,
+	0x00, 0x00, 0x00, 0x03, 0x27, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00,
+	0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00,
+	0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00,
 	0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff
 };
-// 'dither_it_tetris_5', 40x60px
+// 'tetris5', 40x60px
 const unsigned char tetris5 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xbf, 0xef, 0x80, 0xe0, 0x3d, 0xee, 0xbb, 0xc0, 
-	0xf0, 0x3f, 0xbf, 0xff, 0x8b, 0x62, 0xdb, 0x37, 0xcd, 0xc3, 0x70, 0xdf, 0x3e, 0xcf, 0xbf, 0x6f, 
-	0xdd, 0xf7, 0xfb, 0xad, 0x6b, 0x5f, 0xdf, 0x6f, 0xd2, 0xf4, 0xbd, 0x77, 0xbb, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc9, 0x40, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 
-	0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0xb3, 0x40, 0x00, 0x00, 0x00, 
-	0xbf, 0x40, 0x00, 0x00, 0x00, 0xd5, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0xff, 
-	0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xfd, 0x57, 0xff, 0x88, 0x74, 
-	0xba, 0xaf, 0x4b, 0xd5, 0xf7, 0x7b, 0xf7, 0x77, 0x9c, 0x7a, 0xdb, 0x37, 0xad, 0xce, 0xed, 0xbd, 
-	0x2e, 0xf7, 0xa9, 0x77, 0x7b, 0xf7, 0x5b, 0x92, 0xfa, 0xda, 0xaf, 0xad, 0xd4, 0xf7, 0xbd, 0x57, 
-	0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xe9, 0x3a, 0x4e, 0x93, 
-	0x82, 0x64, 0x9b, 0xb6, 0xed, 0xd9, 0x72, 0x5d, 0xf7, 0x7d, 0xae, 0xeb, 0xbb, 0x2e, 0xcb, 0x9c, 
-	0xe7, 0x3b, 0x36, 0xcd, 0xca, 0x72, 0x9b, 0xee, 0xfb, 0xa1, 0x68, 0x5d, 0x67, 0x59, 0xdd, 0xf7, 
-	0x7a, 0x9e, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 
-	0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 
-	0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x03, 0x59, 
-	0x00, 0x00, 0x00, 0x02, 0xa7, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 
-	0xff, 0xff, 0xfc, 0x00, 0xd2, 0xea, 0x5d, 0x2c, 0x00, 0xdd, 0xfb, 0xbd, 0xdc, 0x00, 0xeb, 0x76, 
-	0xfe, 0xb4, 0x00, 0xdd, 0xfb, 0x5b, 0x6c, 0x00, 0xeb, 0x6d, 0xbd, 0xdc, 0x00, 0xbd, 0xf6, 0xfe, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xbf, 0xef, 0x80, 0xe0, 0x3d, 0xee, 0xbb, 0xc0,
+	0xf0, 0x3f, 0xbf, 0xff, 0x8b, 0x62, 0xdb, 0x37, 0xcd, 0xc3, 0x70, 0xdf, 0x3e, 0xcf, 0xbf, 0x6f,
+	0xdd, 0xf7, 0xfb, 0xad, 0x6b, 0x5f, 0xdf, 0x6f, 0xd2, 0xf4, 0xbd, 0x77, 0xbb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc9, 0x40, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00,
+	0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0xb3, 0x40, 0x00, 0x00, 0x00,
+	0xbf, 0x40, 0x00, 0x00, 0x00, 0xd5, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0xff,
+	0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xfd, 0x57, 0xff, 0x88, 0x74,
+	0xba, 0xaf, 0x4b, 0xd5, 0xf7, 0x7b, 0xf7, 0x77, 0x9c, 0x7a, 0xdb, 0x37, 0xad, 0xce, 0xed, 0xbd,
+	0x2e, 0xf7, 0xa9, 0x77, 0x7b, 0xf7, 0x5b, 0x92, 0xfa, 0xda, 0xaf, 0xad, 0xd4, 0xf7, 0xbd, 0x57,
+	0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xe9, 0x3a, 0x4e, 0x93,
+	0x82, 0x64, 0x9b, 0xb6, 0xed, 0xd9, 0x72, 0x5d, 0xf7, 0x7d, 0xae, 0xeb, 0xbb, 0x2e, 0xcb, 0x9c,
+	0xe7, 0x3b, 0x36, 0xcd, 0xca, 0x72, 0x9b, 0xee, 0xfb, 0xa1, 0x68, 0x5d, 0x67, 0x59, 0xdd, 0xf7,
+	0x7a, 0x9e, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,
+	0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03,
+	0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x03, 0x59,
+	0x00, 0x00, 0x00, 0x02, 0xa7, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff,
+	0xff, 0xff, 0xfc, 0x00, 0xd2, 0xea, 0x5d, 0x2c, 0x00, 0xdd, 0xfb, 0xbd, 0xdc, 0x00, 0xeb, 0x76,
+	0xfe, 0xb4, 0x00, 0xdd, 0xfb, 0x5b, 0x6c, 0x00, 0xeb, 0x6d, 0xbd, 0xdc, 0x00, 0xbd, 0xf6, 0xfe,
 	0xb4, 0x00, 0xeb, 0xfb, 0xbd, 0xec, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00
 };
-// 'dither_it_tetris_6', 40x60px
+// 'tetris6', 40x60px
 const unsigned char tetris6 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xbf, 0xef, 0x80, 0xe0, 0x3d, 0xee, 0xbb, 0xc0, 
-	0xf0, 0x3f, 0xbf, 0xff, 0x8b, 0x62, 0xdb, 0x37, 0xcd, 0xc3, 0x70, 0xdf, 0x3e, 0xcf, 0xbf, 0x6f, 
-	0xdd, 0xf7, 0xfb, 0xad, 0x6b, 0x5f, 0xdf, 0x6f, 0xd2, 0xf4, 0xbd, 0x77, 0xbb, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc9, 0x40, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 
-	0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0xb3, 0x40, 0x00, 0x00, 0x00, 
-	0xbf, 0x40, 0x00, 0x00, 0x00, 0xd5, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0xff, 
-	0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf5, 0x5d, 0x57, 0x55, 0x88, 0x60, 
-	0x3a, 0xae, 0x55, 0xd5, 0xf7, 0x5b, 0xf7, 0x47, 0x9c, 0x67, 0x3b, 0x36, 0x29, 0xce, 0xf3, 0x9d, 
-	0x2f, 0x93, 0xa9, 0x6a, 0x5b, 0xf6, 0xab, 0x92, 0xe4, 0xba, 0xae, 0x95, 0xd4, 0xf5, 0x5d, 0x57, 
-	0x53, 0xff, 0xff, 0xff, 0xfe, 0x49, 0xff, 0xff, 0xff, 0xff, 0x27, 0xf7, 0x7b, 0x7e, 0xdf, 0x53, 
-	0xde, 0xef, 0xdb, 0xf6, 0x95, 0xfb, 0xfe, 0xff, 0xbe, 0xab, 0xb3, 0x78, 0xde, 0x36, 0xc5, 0xf3, 
-	0xec, 0xfb, 0x3f, 0x17, 0xff, 0x7f, 0xdf, 0xf7, 0x63, 0xb7, 0xf7, 0xfd, 0xfe, 0x99, 0xed, 0x7d, 
-	0x5f, 0x56, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xc0, 0x00, 0x02, 0xb7, 0xee, 0xc0, 0x00, 
-	0x03, 0x41, 0xdf, 0xc0, 0x00, 0x03, 0x37, 0xfb, 0x40, 0x00, 0x02, 0x93, 0xe3, 0xc0, 0x00, 0x02, 
-	0xc9, 0xb3, 0x40, 0x00, 0x03, 0x17, 0xff, 0xc0, 0x00, 0x03, 0x63, 0xde, 0xc0, 0x00, 0x02, 0x95, 
-	0xf5, 0xc0, 0x00, 0x03, 0x2b, 0xff, 0xc0, 0x00, 0x02, 0xc3, 0xff, 0xff, 0xff, 0xfe, 0x2b, 0xee, 
-	0xff, 0xff, 0xff, 0x55, 0xdb, 0xf4, 0xba, 0x97, 0x25, 0xed, 0x77, 0x7e, 0xef, 0x4b, 0xb6, 0xfa, 
-	0xdd, 0xbe, 0x69, 0xdb, 0xed, 0xbe, 0xd7, 0x87, 0xed, 0x77, 0x7b, 0x6e, 0x33, 0xdb, 0xfa, 0xdd, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xbf, 0xef, 0x80, 0xe0, 0x3d, 0xee, 0xbb, 0xc0,
+	0xf0, 0x3f, 0xbf, 0xff, 0x8b, 0x62, 0xdb, 0x37, 0xcd, 0xc3, 0x70, 0xdf, 0x3e, 0xcf, 0xbf, 0x6f,
+	0xdd, 0xf7, 0xfb, 0xad, 0x6b, 0x5f, 0xdf, 0x6f, 0xd2, 0xf4, 0xbd, 0x77, 0xbb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc9, 0x40, 0x00, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00,
+	0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0xb3, 0x40, 0x00, 0x00, 0x00,
+	0xbf, 0x40, 0x00, 0x00, 0x00, 0xd5, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0xff,
+	0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf5, 0x5d, 0x57, 0x55, 0x88, 0x60,
+	0x3a, 0xae, 0x55, 0xd5, 0xf7, 0x5b, 0xf7, 0x47, 0x9c, 0x67, 0x3b, 0x36, 0x29, 0xce, 0xf3, 0x9d,
+	0x2f, 0x93, 0xa9, 0x6a, 0x5b, 0xf6, 0xab, 0x92, 0xe4, 0xba, 0xae, 0x95, 0xd4, 0xf5, 0x5d, 0x57,
+	0x53, 0xff, 0xff, 0xff, 0xfe, 0x49, 0xff, 0xff, 0xff, 0xff, 0x27, 0xf7, 0x7b, 0x7e, 0xdf, 0x53,
+	0xde, 0xef, 0xdb, 0xf6, 0x95, 0xfb, 0xfe, 0xff, 0xbe, 0xab, 0xb3, 0x78, 0xde, 0x36, 0xc5, 0xf3,
+	0xec, 0xfb, 0x3f, 0x17, 0xff, 0x7f, 0xdf, 0xf7, 0x63, 0xb7, 0xf7, 0xfd, 0xfe, 0x99, 0xed, 0x7d,
+	0x5f, 0x56, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xc0, 0x00, 0x02, 0xb7, 0xee, 0xc0, 0x00,
+	0x03, 0x41, 0xdf, 0xc0, 0x00, 0x03, 0x37, 0xfb, 0x40, 0x00, 0x02, 0x93, 0xe3, 0xc0, 0x00, 0x02,
+	0xc9, 0xb3, 0x40, 0x00, 0x03, 0x17, 0xff, 0xc0, 0x00, 0x03, 0x63, 0xde, 0xc0, 0x00, 0x02, 0x95,
+	0xf5, 0xc0, 0x00, 0x03, 0x2b, 0xff, 0xc0, 0x00, 0x02, 0xc3, 0xff, 0xff, 0xff, 0xfe, 0x2b, 0xee,
+	0xff, 0xff, 0xff, 0x55, 0xdb, 0xf4, 0xba, 0x97, 0x25, 0xed, 0x77, 0x7e, 0xef, 0x4b, 0xb6, 0xfa,
+	0xdd, 0xbe, 0x69, 0xdb, 0xed, 0xbe, 0xd7, 0x87, 0xed, 0x77, 0x7b, 0x6e, 0x33, 0xdb, 0xfa, 0xdd,
 	0xbf, 0x55, 0xf6, 0xf7, 0xbf, 0x6e, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-// 'dither_it_tetris_7', 40x60px
+// 'tetris7', 40x60px
 const unsigned char tetris7 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0xab, 0xc0, 
-	0xf0, 0x3c, 0x0e, 0xfd, 0x8b, 0x62, 0xd8, 0xb6, 0xcd, 0xc3, 0x70, 0xdc, 0x37, 0x4b, 0xbf, 0x6f, 
-	0xdb, 0xf6, 0xfd, 0xad, 0x6b, 0x5a, 0xd7, 0x55, 0xd2, 0xf4, 0xbd, 0x2e, 0xab, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x4e, 0x93, 0x00, 0x00, 0x0d, 0xee, 
-	0xed, 0x00, 0x00, 0x0b, 0xb6, 0xfb, 0x00, 0x00, 0x0b, 0x37, 0x4d, 0x00, 0x00, 0x0d, 0x2e, 0xcd, 
-	0x00, 0x00, 0x0b, 0xf6, 0xfb, 0x00, 0x00, 0x0a, 0xae, 0xab, 0x00, 0x00, 0x0d, 0x57, 0x55, 0x00, 
-	0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 
-	0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 
-	0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 
-	0xab, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xb7, 
-	0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 
-	0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 
-	0x00, 0x03, 0x7d, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 
-	0x03, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x00, 0x00, 0x00, 0x03, 0xbd, 0x00, 0x00, 0x00, 0x02, 
-	0xd7, 0x00, 0x00, 0x00, 0x03, 0xbb, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7, 
-	0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 
-	0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x03, 0x75, 0x00, 0x00, 
-	0x00, 0x02, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x79, 0x00, 0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0xab, 0xc0,
+	0xf0, 0x3c, 0x0e, 0xfd, 0x8b, 0x62, 0xd8, 0xb6, 0xcd, 0xc3, 0x70, 0xdc, 0x37, 0x4b, 0xbf, 0x6f,
+	0xdb, 0xf6, 0xfd, 0xad, 0x6b, 0x5a, 0xd7, 0x55, 0xd2, 0xf4, 0xbd, 0x2e, 0xab, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x4e, 0x93, 0x00, 0x00, 0x0d, 0xee,
+	0xed, 0x00, 0x00, 0x0b, 0xb6, 0xfb, 0x00, 0x00, 0x0b, 0x37, 0x4d, 0x00, 0x00, 0x0d, 0x2e, 0xcd,
+	0x00, 0x00, 0x0b, 0xf6, 0xfb, 0x00, 0x00, 0x0a, 0xae, 0xab, 0x00, 0x00, 0x0d, 0x57, 0x55, 0x00,
+	0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0x25, 0x00, 0x00,
+	0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x4b, 0x00, 0x00, 0x00,
+	0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x02,
+	0xab, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xb7,
+	0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00,
+	0x00, 0x00, 0x03, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x00, 0x00,
+	0x00, 0x03, 0x7d, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,
+	0x03, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x00, 0x00, 0x00, 0x03, 0xbd, 0x00, 0x00, 0x00, 0x02,
+	0xd7, 0x00, 0x00, 0x00, 0x03, 0xbb, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xb7,
+	0x00, 0x00, 0x00, 0x03, 0x6d, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00,
+	0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x03, 0x75, 0x00, 0x00,
+	0x00, 0x02, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x79, 0x00, 0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00,
 	0x02, 0x93, 0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x00, 0x03, 0xff
 };
-// 'dither_it_tetris_8', 40x60px
+// 'tetris8', 40x60px
 const unsigned char tetris8 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0, 
-	0xf0, 0x3d, 0xd7, 0x75, 0x8b, 0x62, 0xd9, 0xce, 0xb3, 0xc3, 0x70, 0xdc, 0xee, 0x7b, 0xbf, 0x6f, 
-	0xda, 0x87, 0x21, 0xad, 0x6b, 0x59, 0x2e, 0x97, 0xd2, 0xf4, 0xbd, 0x57, 0x53, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x40, 0x00, 0x03, 0x2b, 0xb6, 0xc0, 0x00, 0x02, 
-	0x81, 0xbf, 0x40, 0x00, 0x02, 0x6b, 0xd2, 0xc0, 0x00, 0x03, 0x3b, 0xb3, 0x40, 0x00, 0x02, 0xb1, 
-	0xbf, 0x40, 0x00, 0x03, 0x57, 0xd5, 0x40, 0x00, 0x02, 0x09, 0xaa, 0xc0, 0x00, 0x03, 0xb5, 0xff, 
-	0xc0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xcc, 0xc0, 0x00, 0x02, 0x93, 0xa5, 0x40, 
-	0x00, 0x03, 0x25, 0xb1, 0xc0, 0x00, 0x02, 0xab, 0xca, 0x40, 0x00, 0x02, 0x71, 0xc4, 0xc0, 0x00, 
-	0x03, 0x3b, 0xaa, 0xc0, 0x00, 0x02, 0xa5, 0xd5, 0x40, 0x00, 0x02, 0x4b, 0xa4, 0xc0, 0x00, 0x03, 
-	0x53, 0x92, 0x40, 0x00, 0x03, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xf5, 0x5d, 0x57, 0x25, 
-	0xd5, 0x60, 0x3a, 0xae, 0xdb, 0x95, 0xf7, 0x5b, 0xf6, 0xfd, 0xd0, 0x67, 0x3b, 0x37, 0x4b, 0xa5, 
-	0xf3, 0xbb, 0x2e, 0xcd, 0xda, 0xea, 0x1d, 0xf6, 0xfd, 0xc9, 0x64, 0xbb, 0x57, 0x55, 0xa5, 0x75, 
-	0x5c, 0xae, 0xab, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x40, 0x00, 0x03, 0xff, 0xd4, 0xc0, 0x00, 
-	0x03, 0x25, 0xa5, 0x40, 0x00, 0x02, 0xdb, 0xca, 0xc0, 0x00, 0x02, 0xfd, 0xb0, 0xc0, 0x00, 0x03, 
-	0x4b, 0x8b, 0x40, 0x00, 0x02, 0xcd, 0xe8, 0xc0, 0x00, 0x02, 0xfb, 0xca, 0xc0, 0x00, 0x03, 0x59, 
-	0xa5, 0x40, 0x00, 0x02, 0xa7, 0xb2, 0x40, 0x00, 0x03, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x94, 
-	0xff, 0xff, 0xff, 0x25, 0xd2, 0x74, 0xba, 0x96, 0xdb, 0xcb, 0x77, 0x7e, 0xee, 0xfd, 0xa8, 0xfa, 
-	0xdd, 0xbe, 0xcb, 0xd5, 0xed, 0xbe, 0xd7, 0x4d, 0xc4, 0x77, 0x7b, 0x6e, 0xfd, 0xaa, 0xfa, 0xdd, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5d, 0x57, 0x55, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0xc0,
+	0xf0, 0x3d, 0xd7, 0x75, 0x8b, 0x62, 0xd9, 0xce, 0xb3, 0xc3, 0x70, 0xdc, 0xee, 0x7b, 0xbf, 0x6f,
+	0xda, 0x87, 0x21, 0xad, 0x6b, 0x59, 0x2e, 0x97, 0xd2, 0xf4, 0xbd, 0x57, 0x53, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xc9, 0x40, 0x00, 0x03, 0x2b, 0xb6, 0xc0, 0x00, 0x02,
+	0x81, 0xbf, 0x40, 0x00, 0x02, 0x6b, 0xd2, 0xc0, 0x00, 0x03, 0x3b, 0xb3, 0x40, 0x00, 0x02, 0xb1,
+	0xbf, 0x40, 0x00, 0x03, 0x57, 0xd5, 0x40, 0x00, 0x02, 0x09, 0xaa, 0xc0, 0x00, 0x03, 0xb5, 0xff,
+	0xc0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xcc, 0xc0, 0x00, 0x02, 0x93, 0xa5, 0x40,
+	0x00, 0x03, 0x25, 0xb1, 0xc0, 0x00, 0x02, 0xab, 0xca, 0x40, 0x00, 0x02, 0x71, 0xc4, 0xc0, 0x00,
+	0x03, 0x3b, 0xaa, 0xc0, 0x00, 0x02, 0xa5, 0xd5, 0x40, 0x00, 0x02, 0x4b, 0xa4, 0xc0, 0x00, 0x03,
+	0x53, 0x92, 0x40, 0x00, 0x03, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xf5, 0x5d, 0x57, 0x25,
+	0xd5, 0x60, 0x3a, 0xae, 0xdb, 0x95, 0xf7, 0x5b, 0xf6, 0xfd, 0xd0, 0x67, 0x3b, 0x37, 0x4b, 0xa5,
+	0xf3, 0xbb, 0x2e, 0xcd, 0xda, 0xea, 0x1d, 0xf6, 0xfd, 0xc9, 0x64, 0xbb, 0x57, 0x55, 0xa5, 0x75,
+	0x5c, 0xae, 0xab, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x40, 0x00, 0x03, 0xff, 0xd4, 0xc0, 0x00,
+	0x03, 0x25, 0xa5, 0x40, 0x00, 0x02, 0xdb, 0xca, 0xc0, 0x00, 0x02, 0xfd, 0xb0, 0xc0, 0x00, 0x03,
+	0x4b, 0x8b, 0x40, 0x00, 0x02, 0xcd, 0xe8, 0xc0, 0x00, 0x02, 0xfb, 0xca, 0xc0, 0x00, 0x03, 0x59,
+	0xa5, 0x40, 0x00, 0x02, 0xa7, 0xb2, 0x40, 0x00, 0x03, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x94,
+	0xff, 0xff, 0xff, 0x25, 0xd2, 0x74, 0xba, 0x96, 0xdb, 0xcb, 0x77, 0x7e, 0xee, 0xfd, 0xa8, 0xfa,
+	0xdd, 0xbe, 0xcb, 0xd5, 0xed, 0xbe, 0xd7, 0x4d, 0xc4, 0x77, 0x7b, 0x6e, 0xfd, 0xaa, 0xfa, 0xdd,
 	0xbe, 0xab, 0xd5, 0x77, 0xbf, 0x6f, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-// 'dither_it_tetris_9', 40x60px
+// 'tetris9', 40x60px
 const unsigned char tetris9 [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xff, 0xff, 0x80, 0xe0, 0x3d, 0x2e, 0xa5, 0xc0, 
-	0xf0, 0x3d, 0xdf, 0xbb, 0x8b, 0x62, 0xde, 0xb7, 0x6f, 0xc3, 0x70, 0xdb, 0x6f, 0xb5, 0xbf, 0x6f, 
-	0xdd, 0xde, 0xdb, 0xad, 0x6b, 0x5e, 0xb7, 0x6f, 0xd2, 0xf4, 0xbf, 0xef, 0xdb, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xd5, 0x40, 0x00, 0x03, 0xbb, 0x80, 0xc0, 0x00, 0x03, 
-	0x6f, 0xc0, 0x40, 0x00, 0x03, 0xb5, 0x8b, 0xc0, 0x00, 0x02, 0xdb, 0xc3, 0x40, 0x00, 0x03, 0x6f, 
-	0xbf, 0x40, 0x00, 0x03, 0xb5, 0xad, 0x40, 0x00, 0x03, 0x6f, 0xd2, 0xc0, 0x00, 0x03, 0xdb, 0xff, 
-	0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xfe, 0xff, 0xbf, 0x77, 0x82, 0x77, 
-	0xba, 0xef, 0xad, 0xd9, 0x7e, 0xff, 0xfe, 0xdb, 0xae, 0xec, 0xdf, 0x37, 0x6f, 0x9c, 0xfc, 0xfb, 
-	0x3f, 0xb5, 0xca, 0x77, 0xdf, 0xee, 0xdf, 0xa1, 0x7f, 0x7d, 0xbf, 0x6b, 0xdd, 0x75, 0xde, 0xef, 
-	0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x95, 0x53, 0x29, 0x23, 
-	0xca, 0x54, 0x49, 0x54, 0xa9, 0xd1, 0x25, 0xac, 0x45, 0x17, 0x8d, 0x94, 0x13, 0x54, 0xa1, 0xf0, 
-	0x4a, 0xd0, 0xab, 0x6f, 0x87, 0x31, 0x26, 0x20, 0x83, 0xd8, 0x94, 0x95, 0x95, 0x59, 0xaa, 0xd6, 
-	0xf4, 0xb5, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 
-	0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xb9, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 
-	0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x55, 
-	0x00, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 
-	0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 
-	0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x75, 0x5f, 0xff, 0xff, 0x80, 0xe0, 0x3d, 0x2e, 0xa5, 0xc0,
+	0xf0, 0x3d, 0xdf, 0xbb, 0x8b, 0x62, 0xde, 0xb7, 0x6f, 0xc3, 0x70, 0xdb, 0x6f, 0xb5, 0xbf, 0x6f,
+	0xdd, 0xde, 0xdb, 0xad, 0x6b, 0x5e, 0xb7, 0x6f, 0xd2, 0xf4, 0xbf, 0xef, 0xdb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xd5, 0x40, 0x00, 0x03, 0xbb, 0x80, 0xc0, 0x00, 0x03,
+	0x6f, 0xc0, 0x40, 0x00, 0x03, 0xb5, 0x8b, 0xc0, 0x00, 0x02, 0xdb, 0xc3, 0x40, 0x00, 0x03, 0x6f,
+	0xbf, 0x40, 0x00, 0x03, 0xb5, 0xad, 0x40, 0x00, 0x03, 0x6f, 0xd2, 0xc0, 0x00, 0x03, 0xdb, 0xff,
+	0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xfe, 0xff, 0xbf, 0x77, 0x82, 0x77,
+	0xba, 0xef, 0xad, 0xd9, 0x7e, 0xff, 0xfe, 0xdb, 0xae, 0xec, 0xdf, 0x37, 0x6f, 0x9c, 0xfc, 0xfb,
+	0x3f, 0xb5, 0xca, 0x77, 0xdf, 0xee, 0xdf, 0xa1, 0x7f, 0x7d, 0xbf, 0x6b, 0xdd, 0x75, 0xde, 0xef,
+	0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x95, 0x53, 0x29, 0x23,
+	0xca, 0x54, 0x49, 0x54, 0xa9, 0xd1, 0x25, 0xac, 0x45, 0x17, 0x8d, 0x94, 0x13, 0x54, 0xa1, 0xf0,
+	0x4a, 0xd0, 0xab, 0x6f, 0x87, 0x31, 0x26, 0x20, 0x83, 0xd8, 0x94, 0x95, 0x95, 0x59, 0xaa, 0xd6,
+	0xf4, 0xb5, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,
+	0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xb9, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03,
+	0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x03, 0x55,
+	0x00, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00,
+	0x00, 0x00, 0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00,
+	0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00,
 	0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff
 };
-// 'tetris_bg_dither', 200x200px
-const unsigned char tetrisbg [] PROGMEM = {
-	0xff, 0x8a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 
-	0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xc6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xdf, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xca, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xdf, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 
-	0xdc, 0x3f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xca, 0x1f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x70, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x5f, 0x63, 0xe0, 
-	0xf8, 0x3e, 0x1f, 0x87, 0xf9, 0x3f, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x47, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 
-	0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 
-	0x67, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x23, 0xe1, 0xc0, 0x73, 0x9c, 0xe7, 0xe1, 
-	0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x42, 0x1f, 0x60, 0x79, 0xc0, 0x73, 0x9f, 0x87, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x80, 0x44, 0x79, 0xce, 0x73, 0x9d, 
-	0x07, 0x01, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdd, 0x63, 0xe0, 0xf8, 0x3e, 0x1c, 0xe7, 0xf9, 0x37, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x23, 0xe0, 0xf8, 
-	0x3e, 0x1c, 0xe7, 0xf9, 0x1a, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0xff, 0x96, 
-	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdb, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0x1b, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x36, 
-	0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-	0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xad, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x46, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd6, 0xa9, 0x4a, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0xad, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x92, 0xb0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xbf, 0xff, 
-	0xef, 0x77, 0x77, 0x77, 0x7f, 0x7f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x54, 0xd5, 0x29, 0x5a, 0xda, 0xda, 0xda, 0xd2, 0xd5, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xd6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x83, 0xe0, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1d, 
-	0x84, 0x78, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x84, 0x78, 0x00, 0xff, 0x82, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 
-	0x00, 0x11, 0x83, 0xe0, 0x00, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe4, 0x78, 0x00, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 
-	0x00, 0x00, 0x00, 0x1f, 0xe4, 0x78, 0x00, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xe0, 0x00, 
-	0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xe0, 0x00, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x86, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 
-	0xfe, 0xf7, 0x7b, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x8a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x08, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 
-	0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x28, 0x5f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 
-	0xb7, 0x6e, 0xdc, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x70, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 
-	0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 
-	0x67, 0x01, 0xfe, 0x43, 0x9f, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x27, 0x01, 0xf8, 0x43, 0x9f, 
-	0x87, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xaa, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x01, 0xc0, 
-	0x36, 0x1c, 0x07, 0x01, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x67, 0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0x92, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x27, 
-	0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 
-	0x01, 0x3f, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x8a, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x60, 0x00, 0x00, 0x00, 
-	0x11, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x60, 0x00, 
-	0x00, 0x00, 0x0f, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x01, 0x3f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 
-	0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x08, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdf, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0xec, 0x3f, 0xff, 0x90, 0x80, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb1, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-	0x5f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 
-	0xdc, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x70, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x42, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x95, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0x67, 0x00, 
-	0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0x67, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x27, 0x00, 0x30, 0x7b, 0x9f, 0x83, 0xe1, 
-	0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xaa, 0xdf, 0x67, 0x00, 0x30, 0x4f, 0x9c, 0x00, 0x79, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x00, 0x30, 0x47, 0x9c, 
-	0x04, 0x79, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x42, 0x1f, 0x67, 0xf8, 0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0x92, 0x80, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x27, 0xf8, 0xf8, 
-	0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 
-	0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 
-	0xdf, 0x20, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x1c, 0xe0, 
-	0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x60, 0x00, 0x00, 0x00, 
-	0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xd6, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x60, 0x00, 
-	0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 
-	0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0xec, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xca, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb1, 0xa0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 
-	0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xc9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x7f, 0xff, 
-	0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 
-	0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-	0x0f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x42, 0x1f, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0x2f, 0xff, 0xff, 0xff, 
-	0xff, 0xfe, 0x1f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x46, 0x9f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x92, 
-	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xcf, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xd6, 0x9f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x82, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0x38, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0x4f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0xff, 0xba, 0x49, 0x92, 0x40, 0x00, 0x01, 0x9f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x3b, 0x25, 0xc9, 0x40, 0x00, 0x01, 
-	0xcf, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xca, 0x1f, 0xff, 0x3a, 0x93, 0xa4, 0xc0, 0x00, 0x01, 0x4f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0x3a, 0x75, 0x9d, 0x40, 
-	0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdf, 0xff, 0x9b, 0x31, 0xac, 0x40, 0x00, 0x01, 0x9f, 0xff, 0x86, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0x3a, 0x4b, 
-	0x85, 0x40, 0x00, 0x01, 0xcf, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0x3a, 0xa5, 0xd2, 0xc0, 0x00, 0x01, 0x4f, 0xff, 0x96, 
-	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 
-	0xba, 0x13, 0x94, 0x40, 0x00, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xcf, 
-	0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-	0x1f, 0xff, 0x38, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x4f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0x38, 0x00, 0x82, 0x64, 0x90, 
-	0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0xff, 0x98, 0x00, 0xd9, 0x72, 0x50, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x84, 
-	0xe9, 0x30, 0x01, 0xcf, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0x38, 0x00, 0xad, 0x67, 0x50, 0x01, 0x4f, 0xff, 0x96, 0xb0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0xb8, 
-	0x00, 0xac, 0x6b, 0x10, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x92, 0xe1, 0x50, 0x01, 0xcf, 0xff, 
-	0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 
-	0xff, 0x38, 0x00, 0xca, 0x74, 0xb0, 0x01, 0x4f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0x38, 0x00, 0xa1, 0x65, 0x10, 0x01, 
-	0xcf, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x46, 0x9f, 0xff, 0x98, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xcf, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x28, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x92, 0xb0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0xb8, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 
-	0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 
-	0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 
-	0x9f, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x82, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xb8, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x9f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x17, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x0d, 0xbb, 0x76, 0xed, 0xdb, 0xb6, 0x1f, 0xff, 
-	0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 
-	0xff, 0x86, 0xd6, 0xdb, 0x5b, 0x6d, 0x6c, 0x0f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xd5, 0x2a, 0x49, 0x54, 0x95, 0x2a, 0xbf, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 
-	0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+// 'tetrisbg_rle', 200x200px, PackBits
+const unsigned char tetrisbg_rle [] PROGMEM = {
+	0x02, 0xff, 0x8a, 0x50, 0xf5, 0x00, 0x01, 0x29, 0x5f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00,
+	0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1f, 0xf8, 0xff, 0x01,
+	0x92, 0x80, 0xf5, 0x00, 0x01, 0x4a, 0x1f, 0xf8, 0xff, 0x01, 0xb1, 0xa0, 0xf5, 0x00, 0x01, 0xc6,
+	0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x86, 0x10,
+	0xf5, 0x00, 0x01, 0x18, 0x5f, 0xf8, 0xff, 0x01, 0x92, 0xb0, 0xf5, 0x00, 0x01, 0x4a, 0xdf, 0xf8,
+	0xff, 0x01, 0x96, 0x50, 0xf5, 0x00, 0x01, 0x59, 0x5f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00,
+	0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1f, 0xf8, 0xff, 0x01,
+	0x95, 0xa0, 0xf5, 0x00, 0x01, 0xca, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff,
+	0xdf, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x82, 0x10,
+	0xf5, 0x00, 0x01, 0x18, 0xdf, 0xf8, 0xff, 0x01, 0x96, 0xb0, 0xf5, 0x00, 0x01, 0x4a, 0x5f, 0xf8,
+	0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01, 0x90,
+	0x80, 0xf5, 0x00, 0x0c, 0x42, 0x1f, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 0xdc, 0x3f, 0xff, 0x92,
+	0x80, 0xf5, 0x00, 0x0c, 0xca, 0x1f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xb1,
+	0xa0, 0xf5, 0x00, 0x02, 0x46, 0x9f, 0x70, 0xfc, 0x00, 0x04, 0x03, 0x3f, 0xff, 0xbf, 0xf0, 0xf5,
+	0x00, 0x02, 0xff, 0xdf, 0x20, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x0c,
+	0x18, 0x5f, 0x63, 0xe0, 0xf8, 0x3e, 0x1f, 0x87, 0xf9, 0x3f, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x0c,
+	0xaa, 0xdf, 0x47, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 0x96, 0x50, 0xf5, 0x00, 0x0c,
+	0x09, 0x5f, 0x67, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xdf, 0x23, 0xe1, 0xc0, 0x73, 0x9c, 0xe7, 0xe1, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x0c,
+	0x42, 0x1f, 0x60, 0x79, 0xc0, 0x73, 0x9f, 0x87, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x0c,
+	0xd6, 0x80, 0x44, 0x79, 0xce, 0x73, 0x9d, 0x07, 0x01, 0x00, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xdd, 0x63, 0xe0, 0xf8, 0x3e, 0x1c, 0xe7, 0xf9, 0x37, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xd7, 0x23, 0xe0, 0xf8, 0x3e, 0x1c, 0xe7, 0xf9, 0x1a, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x02,
+	0x08, 0x55, 0x60, 0xfc, 0x00, 0x04, 0x01, 0x37, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x02, 0xaa, 0xdb,
+	0x50, 0xfc, 0x00, 0x04, 0x02, 0x2d, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xcd, 0x1b, 0xbd,
+	0xfd, 0xdd, 0x04, 0xda, 0x36, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1b, 0xfa, 0x00, 0x03,
+	0xdb, 0xff, 0x92, 0x80, 0xf5, 0x00, 0x02, 0xca, 0x16, 0x80, 0xfb, 0x00, 0x03, 0xad, 0xff, 0xb1,
+	0xa0, 0xf5, 0x00, 0x01, 0x46, 0x9b, 0xfb, 0xff, 0x04, 0xfe, 0xf6, 0xff, 0xbf, 0xf0, 0xf5, 0x00,
+	0x03, 0xff, 0xd6, 0xa9, 0x4a, 0xfc, 0x55, 0x03, 0xad, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x01, 0x28,
+	0x40, 0xf9, 0x00, 0x02, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x04, 0x8a, 0xdf, 0xbf, 0xff, 0xef, 0xfe,
+	0x77, 0xff, 0x7f, 0x02, 0xff, 0x96, 0x50, 0xf5, 0x00, 0x04, 0x59, 0x54, 0xd5, 0x29, 0x5a, 0xfe,
+	0xda, 0x04, 0xd2, 0xd5, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xc0, 0xf9, 0x00, 0x02, 0xff,
+	0x90, 0x80, 0xf5, 0x00, 0x00, 0x42, 0xf8, 0x00, 0x02, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x01, 0xd6,
+	0x80, 0xfd, 0x00, 0x06, 0x0f, 0x83, 0xe0, 0x00, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xc0,
+	0xfd, 0x00, 0x06, 0x1d, 0x84, 0x78, 0x00, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xc0, 0xfd,
+	0x00, 0x06, 0x1d, 0x84, 0x78, 0x00, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x01, 0x08, 0x40, 0xfd, 0x00,
+	0x06, 0x11, 0x83, 0xe0, 0x00, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x01, 0xaa, 0xc0, 0xfd, 0x00, 0x06,
+	0x11, 0xe4, 0x78, 0x00, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x06, 0x1f,
+	0xe4, 0x78, 0x00, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x00, 0x42, 0xfc, 0x00, 0x06, 0x01, 0x83, 0xe0,
+	0x00, 0xff, 0x92, 0x80, 0xf5, 0x00, 0x00, 0xca, 0xfc, 0x00, 0x06, 0x01, 0x83, 0xe0, 0x00, 0xff,
+	0xb1, 0xa0, 0xf5, 0x00, 0x01, 0x46, 0x80, 0xf9, 0x00, 0x02, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01,
+	0xff, 0xc0, 0xf9, 0x00, 0x02, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x01, 0x28, 0x5f, 0xfd, 0xff, 0x06,
+	0xfe, 0xf7, 0x7b, 0xff, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x01, 0x8a, 0xc0, 0xf9, 0x00, 0x02, 0xff,
+	0x96, 0x50, 0xf5, 0x00, 0x01, 0x59, 0x40, 0xf9, 0x00, 0x02, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x01,
+	0xff, 0xdf, 0xf8, 0xff, 0x01, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1f, 0xf8, 0xff, 0x01, 0x95,
+	0xa0, 0xf5, 0x00, 0x01, 0xd6, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf,
+	0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x82, 0x10, 0xf5,
+	0x00, 0x01, 0x08, 0x5f, 0xf8, 0xff, 0x01, 0x96, 0xb0, 0xf5, 0x00, 0x01, 0xaa, 0xdf, 0xf8, 0xff,
+	0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x90, 0x80, 0xf5, 0x00, 0x01,
+	0x42, 0x1f, 0xf8, 0xff, 0x01, 0x92, 0x80, 0xf5, 0x00, 0x01, 0xca, 0x1f, 0xf8, 0xff, 0x01, 0xb1,
+	0xa0, 0xf5, 0x00, 0x01, 0x46, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf,
+	0xf8, 0xff, 0x01, 0x86, 0x10, 0xf5, 0x00, 0x02, 0x28, 0x5f, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01,
+	0x92, 0xb0, 0xf5, 0x00, 0x0c, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 0xdc, 0x3f, 0xff,
+	0x96, 0x50, 0xf5, 0x00, 0x0c, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x70, 0xfc, 0x00, 0x04, 0x03, 0x3f, 0xff, 0x90, 0x80,
+	0xf5, 0x00, 0x02, 0x42, 0x1f, 0x20, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0xf5, 0x00,
+	0x0c, 0xd6, 0x9f, 0x67, 0x01, 0xfe, 0x43, 0x9f, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00,
+	0x0c, 0xff, 0xdf, 0x47, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00,
+	0x0c, 0xff, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0xf5, 0x00,
+	0x0c, 0x08, 0x5f, 0x27, 0x01, 0xf8, 0x43, 0x9f, 0x87, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0xf5, 0x00,
+	0x0c, 0xaa, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00,
+	0x0c, 0xff, 0xdf, 0x47, 0x01, 0xc0, 0x36, 0x1c, 0x07, 0x01, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00,
+	0x0c, 0x42, 0x1f, 0x67, 0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0x92, 0x80, 0xf5, 0x00,
+	0x0c, 0xca, 0x1f, 0x27, 0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0xb1, 0xa0, 0xf5, 0x00,
+	0x02, 0x46, 0x9f, 0x60, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff,
+	0xdf, 0x40, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x02, 0x28, 0x5f, 0x60,
+	0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x02, 0x8a, 0xdf, 0x20,
+	0xfe, 0x00, 0x06, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0xf5, 0x00, 0x02, 0x59, 0x5f, 0x60,
+	0xfe, 0x00, 0x06, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x40,
+	0xfe, 0x00, 0x06, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x02, 0x42, 0x1f, 0x60,
+	0xfe, 0x00, 0x06, 0x0f, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x02, 0xd6, 0x9f, 0x20,
+	0xfe, 0x00, 0x06, 0x01, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x60,
+	0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x40,
+	0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x02, 0x08, 0x5f, 0x60,
+	0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x02, 0xaa, 0xdf, 0x30, 0xfc, 0x00,
+	0x04, 0x02, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x17, 0xfe, 0xff, 0x06, 0xfb,
+	0xbd, 0xec, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x02, 0x42, 0x1f, 0x80, 0xfb, 0x00, 0xff, 0xff,
+	0x01, 0x92, 0x80, 0xf5, 0x00, 0x02, 0xca, 0x1f, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01, 0xb1, 0xa0,
+	0xf5, 0x00, 0x01, 0x46, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8,
+	0xff, 0x01, 0x86, 0x10, 0xf5, 0x00, 0x02, 0x28, 0x5f, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01, 0x92,
+	0xb0, 0xf5, 0x00, 0x0c, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 0xdc, 0x3f, 0xff, 0x96,
+	0x50, 0xf5, 0x00, 0x0c, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xbf,
+	0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x70, 0xfc, 0x00, 0x04, 0x03, 0x3f, 0xff, 0x90, 0x80, 0xf5,
+	0x00, 0x02, 0x42, 0x1f, 0x20, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x0c,
+	0xd6, 0x9f, 0x67, 0x00, 0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xdf, 0x47, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xdf, 0x67, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x0c,
+	0x08, 0x5f, 0x27, 0x00, 0x30, 0x7b, 0x9f, 0x83, 0xe1, 0x3f, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x0c,
+	0xaa, 0xdf, 0x67, 0x00, 0x30, 0x4f, 0x9c, 0x00, 0x79, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c,
+	0xff, 0xdf, 0x47, 0x00, 0x30, 0x47, 0x9c, 0x04, 0x79, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x0c,
+	0x42, 0x1f, 0x67, 0xf8, 0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0x92, 0x80, 0xf5, 0x00, 0x0c,
+	0xca, 0x1f, 0x27, 0xf8, 0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xb1, 0xa0, 0xf5, 0x00, 0x02,
+	0x46, 0x9f, 0x60, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf,
+	0x40, 0xfc, 0x00, 0x04, 0x01, 0x3f, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x02, 0x28, 0x5f, 0x60, 0xfe,
+	0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x02, 0x8a, 0xdf, 0x20, 0xfe,
+	0x00, 0x06, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0xf5, 0x00, 0x02, 0x59, 0x5f, 0x60, 0xfe,
+	0x00, 0x06, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x40, 0xfe,
+	0x00, 0x06, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x02, 0x42, 0x1f, 0x60, 0xfe,
+	0x00, 0x06, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x02, 0xd6, 0x9f, 0x20, 0xfe,
+	0x00, 0x06, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x60, 0xfe,
+	0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x40, 0xfe,
+	0x00, 0x06, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x02, 0x08, 0x5f, 0x60, 0xfc,
+	0x00, 0x04, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x02, 0xaa, 0xdf, 0x30, 0xfc, 0x00, 0x04,
+	0x02, 0x3f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x02, 0xff, 0xdf, 0x17, 0xfe, 0xff, 0x06, 0xfb, 0xbd,
+	0xec, 0x3f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x02, 0x42, 0x1f, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01,
+	0x92, 0x80, 0xf5, 0x00, 0x02, 0xca, 0x1f, 0x80, 0xfb, 0x00, 0xff, 0xff, 0x01, 0xb1, 0xa0, 0xf5,
+	0x00, 0x01, 0x46, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff,
+	0x01, 0x86, 0x10, 0xf5, 0x00, 0x01, 0x28, 0x5f, 0xf8, 0xff, 0x01, 0x92, 0xb0, 0xf5, 0x00, 0x01,
+	0x8a, 0xdf, 0xf8, 0xff, 0x01, 0x96, 0x50, 0xf5, 0x00, 0x01, 0x59, 0x5f, 0xf8, 0xff, 0x01, 0xbf,
+	0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1f,
+	0xf8, 0xff, 0x01, 0x95, 0xa0, 0xf5, 0x00, 0x01, 0xd6, 0x9f, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5,
+	0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff,
+	0x01, 0x82, 0x10, 0xf5, 0x00, 0x0c, 0x08, 0x5f, 0xff, 0xc9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x7f,
+	0xff, 0x96, 0xb0, 0xf5, 0x00, 0x03, 0xaa, 0xdf, 0xff, 0x80, 0xfc, 0x00, 0x03, 0x1f, 0xff, 0xbf,
+	0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x17, 0xfd, 0xff, 0x04, 0xfe, 0x0f, 0xff, 0x90, 0x80,
+	0xf5, 0x00, 0x03, 0x42, 0x1f, 0xff, 0x9f, 0xfc, 0xff, 0x03, 0x4f, 0xff, 0x92, 0x80, 0xf5, 0x00,
+	0x03, 0xca, 0x1f, 0xff, 0x2f, 0xfd, 0xff, 0x04, 0xfe, 0x1f, 0xff, 0xb1, 0xa0, 0xf5, 0x00, 0x03,
+	0x46, 0x9f, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff,
+	0xdf, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0x9f, 0xff, 0x86, 0x10, 0xf5, 0x00, 0x03, 0x28, 0x5f,
+	0xff, 0xb8, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0x92, 0xb0, 0xf5, 0x00, 0x03, 0x8a, 0xdf, 0xff,
+	0x18, 0xfd, 0x00, 0x04, 0x01, 0x4f, 0xff, 0x96, 0x50, 0xf5, 0x00, 0x03, 0x59, 0x5f, 0xff, 0x38,
+	0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0xb8, 0xfd,
+	0x00, 0x04, 0x01, 0x4f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x03, 0x42, 0x1f, 0xff, 0x38, 0xfd, 0x00,
+	0x04, 0x01, 0xcf, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x03, 0xd6, 0x9f, 0xff, 0x38, 0xfd, 0x00, 0x04,
+	0x01, 0x4f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01,
+	0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x98, 0xfd, 0x00, 0x04, 0x01, 0x9f,
+	0xff, 0x82, 0x10, 0xf5, 0x00, 0x03, 0x08, 0x5f, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff,
+	0x96, 0xb0, 0xf5, 0x00, 0x0c, 0xaa, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0x4f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0xba, 0x49, 0x92, 0x40, 0x00, 0x01, 0x9f, 0xff,
+	0x90, 0x80, 0xf5, 0x00, 0x0c, 0x42, 0x1f, 0xff, 0x3b, 0x25, 0xc9, 0x40, 0x00, 0x01, 0xcf, 0xff,
+	0x92, 0x80, 0xf5, 0x00, 0x0c, 0xca, 0x1f, 0xff, 0x3a, 0x93, 0xa4, 0xc0, 0x00, 0x01, 0x4f, 0xff,
+	0xb1, 0xa0, 0xf5, 0x00, 0x0c, 0x46, 0x9f, 0xff, 0x3a, 0x75, 0x9d, 0x40, 0x00, 0x01, 0xcf, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0x9b, 0x31, 0xac, 0x40, 0x00, 0x01, 0x9f, 0xff,
+	0x86, 0x10, 0xf5, 0x00, 0x0c, 0x28, 0x5f, 0xff, 0x3a, 0x4b, 0x85, 0x40, 0x00, 0x01, 0xcf, 0xff,
+	0x92, 0xb0, 0xf5, 0x00, 0x0c, 0x8a, 0xdf, 0xff, 0x3a, 0xa5, 0xd2, 0xc0, 0x00, 0x01, 0x4f, 0xff,
+	0x96, 0x50, 0xf5, 0x00, 0x0c, 0x59, 0x5f, 0xff, 0xba, 0x13, 0x94, 0x40, 0x00, 0x01, 0x9f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xcf, 0xff,
+	0x90, 0x80, 0xf5, 0x00, 0x0c, 0x42, 0x1f, 0xff, 0x38, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x4f, 0xff,
+	0x95, 0xa0, 0xf5, 0x00, 0x0c, 0xd6, 0x9f, 0xff, 0x38, 0x00, 0x82, 0x64, 0x90, 0x01, 0xcf, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0x98, 0x00, 0xd9, 0x72, 0x50, 0x01, 0x9f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x84, 0xe9, 0x30, 0x01, 0xcf, 0xff,
+	0x82, 0x10, 0xf5, 0x00, 0x0c, 0x08, 0x5f, 0xff, 0x38, 0x00, 0xad, 0x67, 0x50, 0x01, 0x4f, 0xff,
+	0x96, 0xb0, 0xf5, 0x00, 0x0c, 0xaa, 0xdf, 0xff, 0xb8, 0x00, 0xac, 0x6b, 0x10, 0x01, 0x9f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x92, 0xe1, 0x50, 0x01, 0xcf, 0xff,
+	0x90, 0x80, 0xf5, 0x00, 0x0c, 0x42, 0x1f, 0xff, 0x38, 0x00, 0xca, 0x74, 0xb0, 0x01, 0x4f, 0xff,
+	0x92, 0x80, 0xf5, 0x00, 0x0c, 0xca, 0x1f, 0xff, 0x38, 0x00, 0xa1, 0x65, 0x10, 0x01, 0xcf, 0xff,
+	0xb1, 0xa0, 0xf5, 0x00, 0x0c, 0x46, 0x9f, 0xff, 0x98, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x9f, 0xff,
+	0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0x86,
+	0x10, 0xf5, 0x00, 0x03, 0x28, 0x5f, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0x4f, 0xff, 0x92, 0xb0,
+	0xf5, 0x00, 0x03, 0x8a, 0xdf, 0xff, 0xb8, 0xfd, 0x00, 0x04, 0x01, 0x9f, 0xff, 0x96, 0x50, 0xf5,
+	0x00, 0x03, 0x59, 0x5f, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00,
+	0x03, 0xff, 0xdf, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0x4f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x03,
+	0x42, 0x1f, 0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0x95, 0xa0, 0xf5, 0x00, 0x03, 0xd6,
+	0x9f, 0xff, 0x98, 0xfd, 0x00, 0x04, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf,
+	0xff, 0x38, 0xfd, 0x00, 0x04, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff,
+	0x38, 0xfd, 0x00, 0x04, 0x01, 0x4f, 0xff, 0x82, 0x10, 0xf5, 0x00, 0x03, 0x08, 0x5f, 0xff, 0xb8,
+	0xfd, 0x00, 0x04, 0x01, 0x9f, 0xff, 0x96, 0xb0, 0xf5, 0x00, 0x03, 0xaa, 0xdf, 0xff, 0x38, 0xfd,
+	0x00, 0x04, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x17, 0xfc, 0xff,
+	0x03, 0x0f, 0xff, 0x90, 0x80, 0xf5, 0x00, 0x0c, 0x42, 0x1f, 0xff, 0x0d, 0xbb, 0x76, 0xed, 0xdb,
+	0xb6, 0x1f, 0xff, 0x92, 0x80, 0xf5, 0x00, 0x0c, 0xca, 0x1f, 0xff, 0x86, 0xd6, 0xdb, 0x5b, 0x6d,
+	0x6c, 0x0f, 0xff, 0xb1, 0xa0, 0xf5, 0x00, 0x03, 0x46, 0x9f, 0xff, 0x80, 0xfc, 0x00, 0x03, 0x3f,
+	0xff, 0xbf, 0xf0, 0xf5, 0x00, 0x0c, 0xff, 0xdf, 0xff, 0xd5, 0x2a, 0x49, 0x54, 0x95, 0x2a, 0xbf,
+	0xff, 0x86, 0x10, 0xf5, 0x00, 0x01, 0x28, 0x5f, 0xf8, 0xff, 0x01, 0x92, 0xb0, 0xf5, 0x00, 0x01,
+	0x8a, 0xdf, 0xf8, 0xff, 0x01, 0x96, 0x50, 0xf5, 0x00, 0x01, 0x59, 0x5f, 0xf8, 0xff, 0x01, 0xbf,
+	0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf,
+	0xf8, 0xff, 0x01, 0x82, 0x10, 0xf5, 0x00, 0x01, 0x08, 0x5f, 0xf8, 0xff, 0x01, 0x96, 0xb0, 0xf5,
+	0x00, 0x01, 0xaa, 0xdf, 0xf8, 0xff, 0x01, 0xbf, 0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff,
+	0x01, 0x90, 0x80, 0xf5, 0x00, 0x01, 0x42, 0x1f, 0xf8, 0xff, 0x01, 0x92, 0x80, 0xf5, 0x00, 0x01,
+	0xca, 0x1f, 0xf8, 0xff, 0x01, 0xb1, 0xa0, 0xf5, 0x00, 0x01, 0x46, 0x9f, 0xf8, 0xff, 0x01, 0xbf,
+	0xf0, 0xf5, 0x00, 0x01, 0xff, 0xdf, 0xf8, 0xff, 0x01, 0x86, 0x10, 0xf5, 0x00, 0x01, 0x28, 0x5f,
+	0xf8, 0xff, 0x01, 0x92, 0xb0, 0xf5, 0x00, 0x01, 0x8a, 0xdf, 0xf9, 0xff
 };
@@ -1,8 +1,13 @@
 #include "Watchy.h"
 #include "secrets.h"
 
+//8KB of RTC slow memory: 512 bytes for the ULP, about 0.5KB of other state, the core and IDF need some too
+#if BACKGROUND_CACHE_SIZE + FRAME_RETAIN_SIZE > 5120
+#error "BACKGROUND_CACHE_SIZE and FRAME_RETAIN_SIZE leave too little RTC slow memory"
+#endif
+
 WatchyRTC Watchy::RTC;
-GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> Watchy::display(GxEPD2_154_D67(CS, DC, RESET, BUSY));
+WatchyDisplay Watchy::display(WatchyEPD(CS, DC, RESET, BUSY));
 
 RTC_DATA_ATTR int guiState = WATCHFACE_STATE;
 RTC_DATA_ATTR int menuIndex = 0;
@@ -13,56 +18,183 @@ RTC_DATA_ATTR bool BLE_CONFIGURED;
 RTC_DATA_ATTR weatherData currentWeather;
 RTC_DATA_ATTR int updateCounter = 999;
 RTC_DATA_ATTR bool displayFullInit = true;
+RTC_DATA_ATTR uint8_t accelProfile = ACCEL_PROFILE_DEFAULT;
+RTC_DATA_ATTR bool gestureWake = false;
+RTC_DATA_ATTR uint8_t backgroundCache[BACKGROUND_CACHE_SIZE];
+RTC_DATA_ATTR uint16_t backgroundCacheLength = 0; //0 if nothing is cached
+RTC_DATA_ATTR uint32_t backgroundCacheKey;
+RTC_DATA_ATTR uint8_t fullRefreshDay = 0;
+RTC_DATA_ATTR uint8_t quietStart = 0;
+RTC_DATA_ATTR uint8_t quietEnd = 0; //equal to quietStart when off
+RTC_DATA_ATTR bool backgroundSensing = false;
+RTC_DATA_ATTR uint16_t sensorPulseWake = 0;
+RTC_DATA_ATTR uint16_t sensorBatteryWakeMv = 0;
 
 
 void Watchy::init(String datetime) {
-    esp_sleep_wakeup_cause_t wakeup_reason;
-    wakeup_reason = esp_sleep_get_wakeup_cause(); //get wake up reason
-    Wire.begin(SDA, SCL); //init i2c
-    RTC.init();
-
-    // Init the display here for all cases, if unused, it will do nothing
-    display.init(0, displayFullInit, 10, true); // 10ms by spec, and fast pulldown reset
-    display.epd2.setBusyCallback(displayBusyCallback);
-
-    switch (wakeup_reason)
-    {
-        case ESP_SLEEP_WAKEUP_EXT0: //RTC Alarm
-            if(guiState == WATCHFACE_STATE){
-                showWatchFace(true); //partial updates on tick
-            }
-            break;
-        case ESP_SLEEP_WAKEUP_EXT1: //button Press
-            runUI();
-            break;
-        default: //reset
-            RTC.config(datetime);
-            _bmaConfig();
-            showWatchFace(false); //full update on reset
-            break;
+    setCpuFrequencyMhz(_ioMhz);
+    WatchyProfiler::begin();
+    _wakeEvents = _decodeWake();
+    WatchyProfiler::current.wakeEvents = _wakeEvents;
+    WatchyProfiler::current.stubWakes = WatchyWakeStub::collect();
+    _sensorPulses = WatchyULP::takePulses();
+    _resetTime = datetime;
+
+    // Only the subsystems the matching handlers ask for are brought up, an alarm tick
+    // behind a menu or a headless handler never touches the display
+    const uint8_t builtins = sizeof(WAKE_ACTIONS) / sizeof(wakeAction);
+    for(uint8_t i = 0; i < builtins + _wakeExtraCount; i++){
+        const wakeAction &action = i < builtins ? WAKE_ACTIONS[i] : _wakeExtras[i - builtins];
+        if(action.events & _wakeEvents){
+            require(action.needs);
+            (this->*action.handler)();
+        }
     }
     deepSleep();
 }
 
+const wakeAction Watchy::WAKE_ACTIONS[] = {
+    {WAKE_EVENT_RESET, WAKE_NEEDS_RTC | WAKE_NEEDS_DISPLAY, &Watchy::_onReset},
+    {WAKE_EVENT_ALARM, WAKE_NEEDS_RTC, &Watchy::_onAlarm}, //the display only if the face is showing
+    {WAKE_EVENT_GESTURE, WAKE_NEEDS_I2C, &Watchy::_handleAccelInterrupt},
+    {WAKE_EVENT_SENSOR, 0, &Watchy::onSensorWake},
+    {WAKE_EVENT_BUTTON, WAKE_NEEDS_RTC | WAKE_NEEDS_DISPLAY, &Watchy::runUI},
+};
+
+uint8_t Watchy::_decodeWake(){
+    switch(esp_sleep_get_wakeup_cause()){
+        case ESP_SLEEP_WAKEUP_EXT0:
+            return WAKE_EVENT_ALARM;
+        case ESP_SLEEP_WAKEUP_EXT1: {
+            uint64_t status = esp_sleep_get_ext1_wakeup_status();
+            uint8_t events = 0;
+            if(status & ACC_INT_MASK){
+                events |= WAKE_EVENT_GESTURE;
+            }
+            if(status & BTN_PIN_MASK){
+                events |= WAKE_EVENT_BUTTON;
+            }
+            return events;
+        }
+        case ESP_SLEEP_WAKEUP_TIMER:
+            return WAKE_EVENT_TIMER;
+        case ESP_SLEEP_WAKEUP_ULP:
+            return WAKE_EVENT_SENSOR;
+        default:
+            return WAKE_EVENT_RESET;
+    }
+}
+
+bool Watchy::addWakeHandler(uint8_t events, uint8_t needs, wakeHandler handler){
+    if(_wakeExtraCount >= WAKE_EXTRA_HANDLERS){
+        return false;
+    }
+    _wakeExtras[_wakeExtraCount++] = {events, needs, handler};
+    return true;
+}
+
+uint8_t Watchy::getWakeEvents(){
+    return _wakeEvents;
+}
+
+void Watchy::require(uint8_t needs){
+    if(needs & WAKE_NEEDS_RTC){
+        needs |= WAKE_NEEDS_I2C;
+    }
+    needs &= ~_ready;
+    _ready |= needs;
+    if(needs & WAKE_NEEDS_I2C){
+        WatchyI2C::begin(); //init i2c, recovering the bus if a slave is stuck
+    }
+    if(needs & WAKE_NEEDS_RTC){
+        RTC.init();
+    }
+    if(needs & WAKE_NEEDS_DISPLAY){
+        display.init(0, displayFullInit, 10, true); // 10ms by spec, and fast pulldown reset
+        display.epd2.setBusyCallback(displayBusyCallback);
+        display.cacheGlyphs(&DSEG7_Classic_Bold_53); //time digits are redrawn on every tick
+    }
+}
+
+void Watchy::setCpuFrequencies(uint32_t ioMhz, uint32_t drawMhz){
+    _ioMhz = ioMhz;
+    _drawMhz = drawMhz;
+}
+
+void Watchy::_beginPhase(uint8_t phase){
+    setCpuFrequencyMhz(phase == PROFILE_PHASE_DRAW ? _drawMhz : _ioMhz); //no-op at the same frequency
+    WatchyProfiler::beginPhase(phase);
+}
+
+void Watchy::_onReset(){
+    RTC.config(_resetTime);
+    _bmaConfig();
+    invalidateBackground();
+    showWatchFace(false); //full update on reset
+}
+
+void Watchy::_onAlarm(){
+    if(guiState == WATCHFACE_STATE){
+        showWatchFace(true); //partial updates on tick
+    }
+}
+
 void Watchy::displayBusyCallback(const void*) {
     gpio_wakeup_enable((gpio_num_t)BUSY, GPIO_INTR_LOW_LEVEL);
     esp_sleep_enable_gpio_wakeup();
+    uint32_t start = micros();
     esp_light_sleep_start();
+    WatchyProfiler::slept(micros() - start);
 }
 
 void Watchy::deepSleep() {
-    display.hibernate();
-    displayFullInit = false; // Notify not to init it again
+    if(_ready & WAKE_NEEDS_DISPLAY){
+        display.hibernate();
+        displayFullInit = false; // Notify not to init it again
+    }
+    require(WAKE_NEEDS_RTC);
     RTC.clearAlarm(); //resets the alarm flag in the RTC
+    WatchyWakeStub::arm(RTC.rtcType, _quietTicks(), RTC.alarmMinute);
+    WatchyProfiler::end();
      // Set pins 0-39 to input to avoid power leaking out
     for(int i=0; i<40; i++) {
         pinMode(i, INPUT);
     }
+    if(backgroundSensing){
+        WatchyULP::arm(sensorPulseWake, sensorBatteryWakeMv);
+        esp_sleep_enable_ulp_wakeup();
+    }
+    uint64_t ext1Mask = BTN_PIN_MASK;
+    if(gestureWake){
+        sensor.getINT(); //clear any gesture latched while awake so it doesn't wake us straight back up
+        ext1Mask |= ACC_INT_MASK;
+    }
     esp_sleep_enable_ext0_wakeup(RTC_PIN, 0); //enable deep sleep wake on RTC interrupt
-    esp_sleep_enable_ext1_wakeup(BTN_PIN_MASK, ESP_EXT1_WAKEUP_ANY_HIGH); //enable deep sleep wake on button press
+    esp_sleep_enable_ext1_wakeup(ext1Mask, ESP_EXT1_WAKEUP_ANY_HIGH); //enable deep sleep wake on button press and gestures
     esp_deep_sleep_start();
 }
 
+void Watchy::setQuietHours(uint8_t start, uint8_t end){
+    quietStart = start % 24;
+    quietEnd = end % 24;
+}
+
+//alarm wakes the wake stub can handle: the ticks left before quietEnd:00 if the face is showing in quiet hours
+uint16_t Watchy::_quietTicks(){
+    if(quietStart == quietEnd || guiState != WATCHFACE_STATE){
+        return 0;
+    }
+    tmElements_t now;
+    RTC.read(now);
+    bool quiet = quietStart < quietEnd ? (now.Hour >= quietStart && now.Hour < quietEnd)
+                                       : (now.Hour >= quietStart || now.Hour < quietEnd); //over midnight
+    if(!quiet){
+        return 0;
+    }
+    uint16_t minutes = (quietEnd * 60 - (now.Hour * 60 + now.Minute) + 24 * 60) % (24 * 60);
+    return minutes - 1; //the alarm at quietEnd:00 boots and redraws
+}
+
 uint64_t Watchy::readButtonState() {
     return
         (uint64_t)digitalRead(MENU_BTN_PIN) << MENU_BTN_PIN |
@@ -72,81 +204,73 @@ uint64_t Watchy::readButtonState() {
 }
 
 void Watchy::runUI() {
+    require(WAKE_NEEDS_RTC | WAKE_NEEDS_DISPLAY);
+    setFastRefresh(true); //menus and apps trade contrast for latency, the faces switch it back off
     pinMode(MENU_BTN_PIN, INPUT);
     pinMode(BACK_BTN_PIN, INPUT);
     pinMode(UP_BTN_PIN, INPUT);
     pinMode(DOWN_BTN_PIN, INPUT);
     long timeoutStart = millis();
-    uint64_t systemState = esp_sleep_get_ext1_wakeup_status();
+    uint64_t systemState = esp_sleep_get_ext1_wakeup_status() & BTN_PIN_MASK;
     while(true) {
         switch(guiState) {
             case WATCHFACE_STATE:
                 if(systemState & MENU_BTN_MASK) {
-                    showMenu(false);
+                    showMenu(true);
                 } else if(systemState & BACK_BTN_MASK) {
-                    showAltFace(false);
+                    showAltFace(true);
                 } else {
                     return;
                 }
                 break;
             case ALTFACE_STATE:
                 if(systemState & MENU_BTN_MASK) {
-                    showMenu(false);
+                    showMenu(true);
                 } else if(systemState & BACK_BTN_MASK) {
-                    showWatchFace(false);
+                    showWatchFace(true);
                 } else {
                     return;
                 }
                 break;
             case MAIN_MENU_STATE:
                 if(systemState & MENU_BTN_MASK) {
-                    switch(menuIndex) {
-                        case 0:
-                            updateCounter = settings.updateInterval - 1;
-                            showWatchFace(false);
-                            break;
-                        case 1: showBattery(); break;
-                        case 2: showAccelerometer(); break;
-                        case 3: setTime(); break;
-                        case 4: showSyncNTP(); break;
-                        case 5: setupWifi(); break;
-                        case 6: showBuzz(); break;
-                        case 7: showUpdateFW(); break;
-                        default: break;
-                    }
+                    (this->*_menuItem(menuIndex).handler)();
                 } else if(systemState & BACK_BTN_MASK) {
-                    showWatchFace(false);
+                    showWatchFace(true);
                 } else {
-                    bool partialRefresh = true;
+                    int previous = menuIndex;
+                    int previousTop = menuTopIndex;
                     if(systemState & UP_BTN_MASK) {
                         menuIndex--;
                         if(menuIndex < 0) menuIndex = 0;
                         if(menuIndex < menuTopIndex) {
                             menuTopIndex -= MENU_PAGE_LENGTH;
                             if(menuTopIndex < 0) menuTopIndex = 0;
-                            partialRefresh = false;
                         }
                     } else if(systemState & DOWN_BTN_MASK) {
                         menuIndex++;
-                        if(menuIndex > MENU_LENGTH) menuIndex = MENU_LENGTH;
+                        if(menuIndex >= _menuLength()) menuIndex = _menuLength() - 1;
                         if(menuIndex >= menuTopIndex+MENU_PAGE_LENGTH) {
                             menuTopIndex += MENU_PAGE_LENGTH;
-                            partialRefresh = false;
                         }
                     }
-                    showMenu(partialRefresh);
+                    if(menuTopIndex != previousTop) {
+                        showMenu(true); //new page
+                    } else {
+                        _moveMenuSelection(previous);
+                    }
                 }
                 break;
             case APP_STATE:
                 if(systemState & BACK_BTN_MASK) {
-                    showMenu(false);
+                    showMenu(true);
                 }
                 break;
             case FW_UPDATE_STATE:
                 if(systemState & MENU_BTN_MASK) {
                     updateFWBegin();
                 } else if(systemState & BACK_BTN_MASK) {
-                    showMenu(false);
+                    showMenu(true);
                 }
                 break;
         }
@@ -159,55 +283,95 @@ void Watchy::runUI() {
     }
 }
 
+const menuItem Watchy::MENU_ITEMS[] = {
+    {"Sync Now", &Watchy::_syncNow, nullptr},
+    {"Battery Voltage", &Watchy::showBattery, nullptr},
+    {"Show Accelerometer", &Watchy::showAccelerometer, nullptr},
+    {"Set Time", &Watchy::setTime, nullptr},
+    {"Sync NTP", &Watchy::showSyncNTP, nullptr},
+    {"Setup WiFi", &Watchy::setupWifi, nullptr},
+    {"Vibrate Motor", &Watchy::showBuzz, nullptr},
+    {"Update Firmware", &Watchy::showUpdateFW, nullptr},
+};
+const uint8_t Watchy::MENU_BUILTIN_ITEMS = sizeof(MENU_ITEMS) / sizeof(menuItem);
+
 void Watchy::showMenu(bool partialRefresh) {
+    require(WAKE_NEEDS_DISPLAY);
     display.setFullWindow();
     display.fillScreen(GxEPD_BLACK);
-    display.setFont(&FreeMonoBold9pt7b);
+    menuIndex = min(menuIndex, _menuLength() - 1); //items may have been added or removed since the last wake
+    menuTopIndex = menuIndex - menuIndex % MENU_PAGE_LENGTH;
+    for(int row = 0; row < MENU_PAGE_LENGTH && menuTopIndex + row < _menuLength(); row++){
+        _drawMenuRow(row, menuTopIndex + row);
+    }
+    _drawMenuScrollBar();
+    display.display(partialRefresh);
 
-    int16_t  x1, y1;
-    uint16_t w, h;
-    int16_t yPos;
-
-    const char *menuItems[] = {
-        "Sync Now",
-        "Battery Voltage",
-        "Show Accelerometer",
-        "Set Time",
-        "Sync NTP",
-        "Setup WiFi",
-
-        "Vibrate Motor",
-        "Update Firmware",
-        ".",
-        ".",
-        ".",
-        "."
-    };
-    for(int i = 0; i < MENU_PAGE_LENGTH; i++){
-        int j = menuTopIndex + i;
-        if(j > MENU_LENGTH) break;
-        yPos = 30+(MENU_HEIGHT*i);
-        display.setCursor(0, yPos);
-        if(j == menuIndex) {
-            display.getTextBounds(menuItems[j], 0, yPos, &x1, &y1, &w, &h);
-            display.fillRect(x1-1, y1-10, 200, h+15, GxEPD_WHITE);
-            display.setTextColor(GxEPD_BLACK);
-            display.println(menuItems[j]);
-        } else {
-            display.setTextColor(GxEPD_WHITE);
-            display.println(menuItems[j]);
-        }
+    guiState = MAIN_MENU_STATE;
+}
+
+bool Watchy::addMenuItem(const char *label, menuHandler handler, const uint8_t *icon){
+    if(_menuExtraCount >= MENU_EXTRA_ITEMS){
+        return false;
+    }
+    _menuExtras[_menuExtraCount++] = {label, handler, icon};
+    return true;
+}
+
+uint8_t Watchy::_menuLength(){
+    return MENU_BUILTIN_ITEMS + _menuExtraCount;
+}
+
+const menuItem& Watchy::_menuItem(uint8_t index){
+    return (index < MENU_BUILTIN_ITEMS) ? MENU_ITEMS[index] : _menuExtras[index - MENU_BUILTIN_ITEMS];
+}
+
+//the highlight band spans the whole row, the scroll bar is drawn over it
+void Watchy::_drawMenuRow(uint8_t row, uint8_t index){
+    const menuItem &item = _menuItem(index);
+    bool selected = (index == menuIndex);
+    uint16_t fg = selected ? GxEPD_BLACK : GxEPD_WHITE;
+    display.fillRect(0, menuRowTop(row), DISPLAY_WIDTH, MENU_ROW_HEIGHT, selected ? GxEPD_WHITE : GxEPD_BLACK);
+    if(item.icon != nullptr){
+        display.drawBitmap(0, menuBaseline(row) - MENU_ICON_SIZE + 2, item.icon, MENU_ICON_SIZE, MENU_ICON_SIZE, fg);
     }
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(fg);
+    display.setCursor(item.icon != nullptr ? MENU_LABEL_X : 0, menuBaseline(row));
+    display.print(item.label);
+}
 
-    // draw scroll bar
-    display.setCursor(0, 0);
+void Watchy::_drawMenuScrollBar(){
     display.fillRect(190,
-            16.f + ((float)menuIndex/(float)MENU_LENGTH)*168.f,
-            6, 168.f / (float)MENU_LENGTH, GxEPD_WHITE);
+            16.f + ((float)menuIndex/(float)_menuLength())*168.f,
+            6, 168.f / (float)_menuLength(), GxEPD_WHITE);
+}
 
-    display.display(partialRefresh);
+//Redraw only the rows that lost and gained the highlight, on top of the page the panel shows.
+//The display diffs the frame, so only those rows and the scroll bar column are sent
+void Watchy::_moveMenuSelection(int previous){
+    if(previous == menuIndex){
+        return;
+    }
+    if(guiState != MAIN_MENU_STATE || !display.restoreShownFrame()){
+        showMenu(true);
+        return;
+    }
+    display.setFullWindow();
+    display.fillRect(190, 0, 6, DISPLAY_HEIGHT, GxEPD_BLACK); //old scroll bar, only the highlighted rows are white there
+    for(int row = 0; row < MENU_PAGE_LENGTH && menuTopIndex + row < _menuLength(); row++){
+        int index = menuTopIndex + row;
+        if(index == previous || index == menuIndex){
+            _drawMenuRow(row, index);
+        }
+    }
+    _drawMenuScrollBar();
+    display.display(true);
+}
 
-    guiState = MAIN_MENU_STATE;
+void Watchy::_syncNow(){
+    updateCounter = settings.updateInterval - 1;
+    showWatchFace(true);
 }
 
 void Watchy::showBattery(){
@@ -221,7 +385,7 @@ void Watchy::showBattery(){
     display.setCursor(70, 80);
     display.print(voltage);
     display.println("V");
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
 
     guiState = APP_STATE;
 }
@@ -233,9 +397,9 @@ void Watchy::showBuzz(){
     display.setTextColor(GxEPD_WHITE);
     display.setCursor(70, 80);
     display.println("Buzz!");
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
     vibMotor();
-    showMenu(false);
+    showMenu(true);
 }
 
 void Watchy::vibMotor(uint8_t intervalMs, uint8_t length){
@@ -248,230 +412,310 @@ void Watchy::vibMotor(uint8_t intervalMs, uint8_t length){
     }
 }
 
-void Watchy::setTime(){
-    guiState = APP_STATE;
-
-    RTC.read(currentTime);
-
-    int8_t minute = currentTime.Minute;
-    int8_t hour = currentTime.Hour;
-    int8_t day = currentTime.Day;
-    int8_t month = currentTime.Month;
-    int8_t year = tmYearToY2k(currentTime.Year);
-
-    int8_t setIndex = SET_HOUR;
-
-    int8_t blink = 0;
-
-    pinMode(DOWN_BTN_PIN, INPUT);
-    pinMode(UP_BTN_PIN, INPUT);
-    pinMode(MENU_BTN_PIN, INPUT);
-    pinMode(BACK_BTN_PIN, INPUT);
-
-    display.setFullWindow();
-
-    while(1){
-
-    if(digitalRead(MENU_BTN_PIN) == 1){
-        setIndex++;
-        if(setIndex > SET_DAY){
-        break;
+//Set Time: UP/DOWN change the selected field, which blinks. MENU selects the next field and saves after
+//the day, BACK the previous one
+class SetTimeApp : public WatchyApp {
+    public:
+        void onEnter(Watchy &watchy) override {
+            Watchy::RTC.read(watchy.currentTime);
+            minute = watchy.currentTime.Minute;
+            hour = watchy.currentTime.Hour;
+            day = watchy.currentTime.Day;
+            month = watchy.currentTime.Month;
+            year = tmYearToY2k(watchy.currentTime.Year);
+            setIndex = SET_HOUR;
+            blink = 1;
+            _draw();
         }
-    }
-    if(digitalRead(BACK_BTN_PIN) == 1){
-        if(setIndex != SET_HOUR){
-        setIndex--;
+        bool onButton(Watchy &watchy, uint64_t buttons) override {
+            if(buttons & MENU_BTN_MASK){
+                setIndex++;
+                if(setIndex > SET_DAY){
+                    return false;
+                }
+            }
+            if(buttons & BACK_BTN_MASK){
+                if(setIndex != SET_HOUR){
+                    setIndex--;
+                }
+            }
+            if(buttons & DOWN_BTN_MASK){
+                switch(setIndex){
+                case SET_HOUR:
+                    hour == 23 ? (hour = 0) : hour++;
+                    break;
+                case SET_MINUTE:
+                    minute == 59 ? (minute = 0) : minute++;
+                    break;
+                case SET_YEAR:
+                    year == 99 ? (year = 0) : year++;
+                    break;
+                case SET_MONTH:
+                    month == 12 ? (month = 1) : month++;
+                    break;
+                case SET_DAY:
+                    day == 31 ? (day = 1) : day++;
+                    break;
+                default:
+                    break;
+                }
+            }
+            if(buttons & UP_BTN_MASK){
+                switch(setIndex){
+                case SET_HOUR:
+                    hour == 0 ? (hour = 23) : hour--;
+                    break;
+                case SET_MINUTE:
+                    minute == 0 ? (minute = 59) : minute--;
+                    break;
+                case SET_YEAR:
+                    year == 0 ? (year = 99) : year--;
+                    break;
+                case SET_MONTH:
+                    month == 1 ? (month = 12) : month--;
+                    break;
+                case SET_DAY:
+                    day == 1 ? (day = 31) : day--;
+                    break;
+                default:
+                    break;
+                }
+            }
+            blink = 1;
+            _draw();
+            return true;
         }
-    }
-
-    blink = 1 - blink;
-
-    if(digitalRead(DOWN_BTN_PIN) == 1){
-        blink = 1;
-        switch(setIndex){
-        case SET_HOUR:
-            hour == 23 ? (hour = 0) : hour++;
-            break;
-        case SET_MINUTE:
-            minute == 59 ? (minute = 0) : minute++;
-            break;
-        case SET_YEAR:
-            year == 99 ? (year = 0) : year++;
-            break;
-        case SET_MONTH:
-            month == 12 ? (month = 1) : month++;
-            break;
-        case SET_DAY:
-            day == 31 ? (day = 1) : day++;
-            break;
-        default:
-            break;
+        void onTick(Watchy &watchy) override {
+            blink = 1 - blink;
+            _draw();
         }
-    }
-
-    if(digitalRead(UP_BTN_PIN) == 1){
-        blink = 1;
-        switch(setIndex){
-        case SET_HOUR:
-            hour == 0 ? (hour = 23) : hour--;
-            break;
-        case SET_MINUTE:
-            minute == 0 ? (minute = 59) : minute--;
-            break;
-        case SET_YEAR:
-            year == 0 ? (year = 99) : year--;
-            break;
-        case SET_MONTH:
-            month == 1 ? (month = 12) : month--;
-            break;
-        case SET_DAY:
-            day == 1 ? (day = 31) : day--;
-            break;
-        default:
-            break;
+        void onExit(Watchy &watchy) override {
+            tmElements_t tm;
+            tm.Month = month;
+            tm.Day = day;
+            tm.Year = y2kYearToTm(year);
+            tm.Hour = hour;
+            tm.Minute = minute;
+            tm.Second = 0;
+            Watchy::RTC.set(tm);
         }
-    }
-
-    display.fillScreen(GxEPD_BLACK);
-    display.setTextColor(GxEPD_WHITE);
-    display.setFont(&DSEG7_Classic_Bold_53);
-
-    display.setCursor(5, 80);
-    if(setIndex == SET_HOUR){//blink hour digits
-        display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
-    }
-    if(hour < 10){
-        display.print("0");
-    }
-    display.print(hour);
-
-    display.setTextColor(GxEPD_WHITE);
-    display.print(":");
-
-    display.setCursor(108, 80);
-    if(setIndex == SET_MINUTE){//blink minute digits
-        display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
-    }
-    if(minute < 10){
-        display.print("0");
-    }
-    display.print(minute);
+        uint32_t tickInterval() override {
+            return 500;
+        }
+    private:
+        int8_t minute, hour, day, month, year;
+        int8_t setIndex;
+        int8_t blink;
+        void _draw(){
+            WatchyDisplay &display = Watchy::display;
+            display.fillScreen(GxEPD_BLACK);
+            display.setTextColor(GxEPD_WHITE);
+            display.setFont(&DSEG7_Classic_Bold_53);
 
-    display.setTextColor(GxEPD_WHITE);
+            display.setCursor(5, 80);
+            if(setIndex == SET_HOUR){//blink hour digits
+                display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
+            }
+            if(hour < 10){
+                display.print("0");
+            }
+            display.print(hour);
 
-    display.setFont(&FreeMonoBold9pt7b);
-    display.setCursor(45, 150);
-    if(setIndex == SET_YEAR){//blink minute digits
-        display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
-    }
-    display.print(2000+year);
+            display.setTextColor(GxEPD_WHITE);
+            display.print(":");
 
-    display.setTextColor(GxEPD_WHITE);
-    display.print("/");
+            display.setCursor(108, 80);
+            if(setIndex == SET_MINUTE){//blink minute digits
+                display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
+            }
+            if(minute < 10){
+                display.print("0");
+            }
+            display.print(minute);
 
-    if(setIndex == SET_MONTH){//blink minute digits
-        display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
-    }
-    if(month < 10){
-        display.print("0");
-    }
-    display.print(month);
+            display.setTextColor(GxEPD_WHITE);
 
-    display.setTextColor(GxEPD_WHITE);
-    display.print("/");
+            display.setFont(&FreeMonoBold9pt7b);
+            display.setCursor(45, 150);
+            if(setIndex == SET_YEAR){//blink year digits
+                display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
+            }
+            display.print(2000+year);
 
-    if(setIndex == SET_DAY){//blink minute digits
-        display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
-    }
-    if(day < 10){
-        display.print("0");
-    }
-    display.print(day);
-    display.display(true); //partial refresh
-    }
+            display.setTextColor(GxEPD_WHITE);
+            display.print("/");
 
-    tmElements_t tm;
-    tm.Month = month;
-    tm.Day = day;
-    tm.Year = y2kYearToTm(year);
-    tm.Hour = hour;
-    tm.Minute = minute;
-    tm.Second = 0;
+            if(setIndex == SET_MONTH){//blink month digits
+                display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
+            }
+            if(month < 10){
+                display.print("0");
+            }
+            display.print(month);
 
-    RTC.set(tm);
+            display.setTextColor(GxEPD_WHITE);
+            display.print("/");
 
-    showMenu(false);
+            if(setIndex == SET_DAY){//blink day digits
+                display.setTextColor(blink ? GxEPD_WHITE : GxEPD_BLACK);
+            }
+            if(day < 10){
+                display.print("0");
+            }
+            display.print(day);
+        }
+};
+
+//live accelerometer readout, 5 times a second at the high rate profile
+class AccelerometerApp : public WatchyApp {
+    public:
+        void onEnter(Watchy &watchy) override {
+            previousProfile = watchy.getAccelProfile();
+            watchy.setAccelProfile(ACCEL_PROFILE_HIGH_RATE);
+            _draw();
+        }
+        void onTick(Watchy &watchy) override {
+            _draw();
+        }
+        void onExit(Watchy &watchy) override {
+            watchy.setAccelProfile(previousProfile);
+        }
+        uint32_t tickInterval() override {
+            return 200;
+        }
+    private:
+        uint8_t previousProfile;
+        void _draw(){
+            WatchyDisplay &display = Watchy::display;
+            Accel acc;
+            // Get acceleration data
+            bool res = sensor.getAccel(acc);
+            uint8_t direction = sensor.getDirection();
+            display.fillScreen(GxEPD_BLACK);
+            display.setFont(&FreeMonoBold9pt7b);
+            display.setTextColor(GxEPD_WHITE);
+            display.setCursor(0, 30);
+            if(res == false) {
+                display.println("getAccel FAIL");
+                return;
+            }
+            display.print("  X:"); display.println(acc.x);
+            display.print("  Y:"); display.println(acc.y);
+            display.print("  Z:"); display.println(acc.z);
+
+            display.setCursor(30, 130);
+            switch(direction){
+                case DIRECTION_DISP_DOWN:
+                    display.println("FACE DOWN");
+                    break;
+                case DIRECTION_DISP_UP:
+                    display.println("FACE UP");
+                    break;
+                case DIRECTION_BOTTOM_EDGE:
+                    display.println("BOTTOM EDGE");
+                    break;
+                case DIRECTION_TOP_EDGE:
+                    display.println("TOP EDGE");
+                    break;
+                case DIRECTION_RIGHT_EDGE:
+                    display.println("RIGHT EDGE");
+                    break;
+                case DIRECTION_LEFT_EDGE:
+                    display.println("LEFT EDGE");
+                    break;
+                default:
+                    display.println("ERROR!!!");
+                    break;
+            }
+        }
+};
 
+void Watchy::setTime(){
+    SetTimeApp app;
+    runApp(app);
 }
 
 void Watchy::showAccelerometer(){
-    display.setFullWindow();
-    display.fillScreen(GxEPD_BLACK);
-    display.setFont(&FreeMonoBold9pt7b);
-    display.setTextColor(GxEPD_WHITE);
-
-    Accel acc;
-
-    long previousMillis = 0;
-    long interval = 200;
+    AccelerometerApp app;
+    runApp(app);
+}
 
+void Watchy::runApp(WatchyApp &app){
     guiState = APP_STATE;
-
-    pinMode(BACK_BTN_PIN, INPUT);
-
-    while(1){
-
-    unsigned long currentMillis = millis();
-
-    if(digitalRead(BACK_BTN_PIN) == 1){
-        break;
-    }
-
-    if(currentMillis - previousMillis > interval){
-        previousMillis = currentMillis;
-        // Get acceleration data
-        bool res = sensor.getAccel(acc);
-        uint8_t direction = sensor.getDirection();
-        display.fillScreen(GxEPD_BLACK);
-        display.setCursor(0, 30);
-        if(res == false) {
-            display.println("getAccel FAIL");
-        }else{
-        display.print("  X:"); display.println(acc.x);
-        display.print("  Y:"); display.println(acc.y);
-        display.print("  Z:"); display.println(acc.z);
-
-        display.setCursor(30, 130);
-        switch(direction){
-            case DIRECTION_DISP_DOWN:
-                display.println("FACE DOWN");
-                break;
-            case DIRECTION_DISP_UP:
-                display.println("FACE UP");
-                break;
-            case DIRECTION_BOTTOM_EDGE:
-                display.println("BOTTOM EDGE");
-                break;
-            case DIRECTION_TOP_EDGE:
-                display.println("TOP EDGE");
-                break;
-            case DIRECTION_RIGHT_EDGE:
-                display.println("RIGHT EDGE");
-                break;
-            case DIRECTION_LEFT_EDGE:
-                display.println("LEFT EDGE");
-                break;
-            default:
-                display.println("ERROR!!!");
+    display.setFullWindow();
+    app.onEnter(*this);
+    display.display(true);
+
+    int16_t x, y, w, h;
+    app.refreshRegion(x, y, w, h);
+    uint32_t interval = app.tickInterval();
+    uint32_t nextTick = millis() + interval;
+    uint64_t held = readButtonState(); //the press that opened the app is not an event
+    bool repeat = false; //held since an event, delivered again at repeatAt
+    uint32_t repeatAt = 0;
+    while(true){
+        uint64_t buttons = readButtonState();
+        held &= buttons; //released buttons count again
+        uint32_t now = millis();
+        if(repeat && held && (int32_t)(now - repeatAt) >= 0){
+            held = 0;
+        }
+        bool redraw = false;
+        if(buttons & ~held){
+            if(!app.onButton(*this, buttons & ~held)){
                 break;
+            }
+            held = buttons;
+            repeat = true;
+            repeatAt = millis() + APP_BUTTON_REPEAT_MS;
+            redraw = true;
+        }else if(interval > 0 && (int32_t)(now - nextTick) >= 0){
+            app.onTick(*this);
+            nextTick += interval;
+            if((int32_t)(now - nextTick) >= 0){
+                nextTick = now + interval; //fell behind, don't catch up
+            }
+            redraw = true;
         }
-
+        if(redraw){
+            display.setPartialWindow(x, y, w, h);
+            display.display(true);
+            display.setFullWindow();
+            continue;
         }
-        display.display(true); //full refresh
-    }
+        uint32_t wait = UINT32_MAX;
+        if(interval > 0){
+            wait = nextTick - now;
+        }
+        if(repeat && held){
+            wait = min(wait, repeatAt - now);
+        }
+        _lightSleep(held, wait);
     }
+    app.onExit(*this);
+    showMenu(true);
+}
 
-    showMenu(false);
+//Light sleep until a button changes or waitMs passes: held buttons wake on release, the others on press
+void Watchy::_lightSleep(uint64_t held, uint32_t waitMs){
+    const uint8_t pins[] = {MENU_BTN_PIN, BACK_BTN_PIN, UP_BTN_PIN, DOWN_BTN_PIN};
+    gpio_wakeup_disable((gpio_num_t)BUSY); //left on by displayBusyCallback, the idle panel holds it low
+    for(uint8_t pin : pins){
+        gpio_wakeup_enable((gpio_num_t)pin, (held & (1ULL << pin)) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+    if(waitMs != UINT32_MAX){
+        esp_sleep_enable_timer_wakeup((uint64_t)waitMs * 1000);
+    }
+    uint32_t start = micros();
+    esp_light_sleep_start();
+    WatchyProfiler::slept(micros() - start);
+    for(uint8_t pin : pins){
+        gpio_wakeup_disable((gpio_num_t)pin);
+    }
+    if(waitMs != UINT32_MAX){
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    }
 }
 
 bool Watchy::networkUpdate() {
@@ -504,13 +748,60 @@ bool Watchy::networkUpdate() {
 }
 
 void Watchy::showWatchFace(bool partialRefresh){
+    require(WAKE_NEEDS_RTC | WAKE_NEEDS_DISPLAY);
     networkUpdate();
+    //one scheduled full refresh a day, at the first tick past FULL_REFRESH_HOUR
+    if(currentTime.Hour >= FULL_REFRESH_HOUR && currentTime.Day != fullRefreshDay){
+        fullRefreshDay = currentTime.Day;
+        display.requestFullRefresh();
+    }
+    setFastRefresh(false);
     display.setFullWindow();
-    drawWatchFace();
+    _beginPhase(PROFILE_PHASE_DRAW);
+    //the panel still shows the last tick of this face: let the face patch it if it can
+    bool updated = partialRefresh && guiState == WATCHFACE_STATE && display.restoreShownFrame();
+    if(updated && !updateWatchFace()){
+        display.fillScreen(GxEPD_BLACK); //back to the blank buffer drawWatchFace expects
+        updated = false;
+    }
+    if(!updated){
+        _drawBackground();
+        drawWatchFace();
+    }
+    _beginPhase(PROFILE_PHASE_IO);
     display.display(partialRefresh);
     guiState = WATCHFACE_STATE;
 }
 
+bool Watchy::updateWatchFace(){
+    return false;
+}
+
+bool Watchy::drawWatchFaceBackground(){
+    return false;
+}
+
+uint32_t Watchy::watchFaceBackgroundKey(){
+    return 0;
+}
+
+void Watchy::invalidateBackground(){
+    backgroundCacheLength = 0;
+}
+
+void Watchy::_drawBackground(){
+    uint32_t key = watchFaceBackgroundKey();
+    if(backgroundCacheLength > 0 && backgroundCacheKey == key){
+        display.unpackBuffer(backgroundCache, backgroundCacheLength);
+        return;
+    }
+    backgroundCacheLength = 0;
+    if(drawWatchFaceBackground()){
+        backgroundCacheLength = display.packBuffer(backgroundCache, BACKGROUND_CACHE_SIZE); //stays 0 if it doesn't fit
+        backgroundCacheKey = key;
+    }
+}
+
 void Watchy::drawWatchFace(){
     display.setFont(&DSEG7_Classic_Bold_53);
     display.setCursor(5, 53+60);
@@ -526,9 +817,13 @@ void Watchy::drawWatchFace(){
 }
 
 void Watchy::showAltFace(bool partialRefresh) {
+    require(WAKE_NEEDS_RTC | WAKE_NEEDS_DISPLAY);
     networkUpdate();
+    setFastRefresh(false);
     display.setFullWindow();
+    _beginPhase(PROFILE_PHASE_DRAW);
     drawAltFace();
+    _beginPhase(PROFILE_PHASE_IO);
     display.display(partialRefresh);
     guiState = ALTFACE_STATE;
 }
@@ -544,30 +839,24 @@ weatherData* Watchy::getWeatherData(){
 }
 
 float Watchy::getBatteryVoltage(){
-    if(RTC.rtcType == DS3231){
-        return analogReadMilliVolts(V10_ADC_PIN) / 1000.0f * 2.0f; // Battery voltage goes through a 1/2 divider.
-    }else{
-        return analogReadMilliVolts(V15_ADC_PIN) / 1000.0f * 2.0f;
+    uint16_t mv = WatchyULP::batteryMillivolts(); //at most a minute old, and leaves ADC1 to the ULP
+    if(mv == 0){
+        mv = analogReadMilliVolts(_batteryPin()) * BATTERY_DIVIDER;
     }
+    return mv / 1000.0f;
+}
+
+uint8_t Watchy::_batteryPin(){
+    require(WAKE_NEEDS_RTC); //the divider differs between boards, told apart by the RTC
+    return RTC.rtcType == DS3231 ? V10_ADC_PIN : V15_ADC_PIN;
 }
 
 uint16_t Watchy::_readRegister(uint8_t address, uint8_t reg, uint8_t *data, uint16_t len) {
-    Wire.beginTransmission(address);
-    Wire.write(reg);
-    Wire.endTransmission();
-    Wire.requestFrom((uint8_t)address, (uint8_t)len);
-    uint8_t i = 0;
-    while (Wire.available()) {
-        data[i++] = Wire.read();
-    }
-    return 0;
+    return WatchyI2C::readRegisters(address, reg, data, (uint8_t)len);
 }
 
 uint16_t Watchy::_writeRegister(uint8_t address, uint8_t reg, uint8_t *data, uint16_t len) {
-    Wire.beginTransmission(address);
-    Wire.write(reg);
-    Wire.write(data, len);
-    return (0 !=  Wire.endTransmission());
+    return (0 != WatchyI2C::writeRegisters(address, reg, data, (uint8_t)len));
 }
 
 void Watchy::_bmaConfig(){
@@ -577,6 +866,130 @@ void Watchy::_bmaConfig(){
         return;
     }
 
+    // Advanced power save must be off while the feature config is written
+    sensor.wakeUp();
+
+    struct bma4_int_pin_config config ;
+    config.edge_ctrl = BMA4_LEVEL_TRIGGER;
+    config.lvl = BMA4_ACTIVE_HIGH;
+    config.od = BMA4_PUSH_PULL;
+    config.output_en = BMA4_OUTPUT_ENABLE;
+    config.input_en = BMA4_INPUT_DISABLE;
+    // The correct trigger interrupt needs to be configured as needed
+    sensor.setINTPinConfig(config, BMA4_INTR1_MAP);
+
+    struct bma423_axes_remap remap_data;
+    remap_data.x_axis = 1;
+    remap_data.x_axis_sign = 0xFF;
+    remap_data.y_axis = 0;
+    remap_data.y_axis_sign = 0xFF;
+    remap_data.z_axis = 2;
+    remap_data.z_axis_sign = 0xFF;
+    // Need to raise the wrist function, need to set the correct axis
+    sensor.setRemapAxes(&remap_data);
+
+    _applyAccelProfile(accelProfile);
+
+    // Reset steps
+    sensor.resetStepCounter();
+}
+
+void Watchy::setAccelProfile(uint8_t profile){
+    if(profile > ACCEL_PROFILE_HIGH_RATE || profile == accelProfile){
+        return;
+    }
+    accelProfile = profile;
+    sensor.wakeUp(); //leave advanced power save while reconfiguring
+    _applyAccelProfile(profile);
+}
+
+uint8_t Watchy::getAccelProfile(){
+    return accelProfile;
+}
+
+void Watchy::setGestureWake(bool enable){
+    if(enable && backgroundSensing){
+        return; //INT1 carries the pulses the ULP counts
+    }
+    gestureWake = enable;
+    if(enable && accelProfile != ACCEL_PROFILE_INTERACTIVE && accelProfile != ACCEL_PROFILE_HIGH_RATE){
+        setAccelProfile(ACCEL_PROFILE_INTERACTIVE); //gestures need the tilt and double tap features
+    }
+    // Latch INT1 so a gesture is still pending when we read the status after waking
+    sensor.setINTMode(enable ? BMA4_LATCH_MODE : BMA4_NON_LATCH_MODE);
+}
+
+bool Watchy::getGestureWake(){
+    return gestureWake;
+}
+
+void Watchy::_handleAccelInterrupt(){
+    // One burst read of INT_STATUS and the step counter, it also clears the latched INT1 line.
+    // The handlers can use sensor.getLastCounter() without another transaction
+    if(!sensor.update()){
+        return;
+    }
+    if(sensor.isDoubleClick()){
+        onDoubleTap();
+    }
+    if(sensor.isTilt()){
+        onTilt();
+    }
+}
+
+void Watchy::onDoubleTap(){
+    if(guiState == WATCHFACE_STATE){
+        showWatchFace(true);
+    }
+}
+
+void Watchy::onTilt(){
+    if(guiState == WATCHFACE_STATE){
+        showWatchFace(true);
+    }
+}
+
+void Watchy::setBackgroundSensing(bool enable, uint16_t pulseWake, uint16_t batteryWakeMv){
+    require(WAKE_NEEDS_I2C);
+    backgroundSensing = enable;
+    sensorPulseWake = pulseWake;
+    sensorBatteryWakeMv = batteryWakeMv;
+    if(enable){
+        gestureWake = false; //the ULP owns INT1
+        sensor.setINTMode(BMA4_NON_LATCH_MODE); //pulses, a latched line would count once
+    }
+    sensor.wakeUp();
+    _applyAccelProfile(accelProfile); //maps the step counter interrupt
+    if(enable && !WatchyULP::running()){
+        WatchyULP::start(_batteryPin());
+    }else if(!enable && WatchyULP::running()){
+        WatchyULP::stop();
+    }
+}
+
+bool Watchy::getBackgroundSensing(){
+    return backgroundSensing;
+}
+
+uint16_t Watchy::getSensorPulses(){
+    return _sensorPulses;
+}
+
+void Watchy::onSensorWake(){
+    if(guiState == WATCHFACE_STATE){
+        showWatchFace(true);
+    }
+}
+
+void Watchy::setFastRefresh(bool fast){
+    display.epd2.setFastRefresh(fast);
+}
+
+bool Watchy::getFastRefresh(){
+    return display.epd2.getFastRefresh();
+}
+
+void Watchy::_applyAccelProfile(uint8_t profile){
     // Accel parameter structure
     Acfg cfg;
     /*!
@@ -594,7 +1007,7 @@ void Watchy::_bmaConfig(){
             - BMA4_OUTPUT_DATA_RATE_800HZ
             - BMA4_OUTPUT_DATA_RATE_1600HZ
     */
-    cfg.odr = BMA4_OUTPUT_DATA_RATE_100HZ;
+    cfg.odr = BMA4_OUTPUT_DATA_RATE_50HZ;
     /*!
         G-range, Optional parameters:
             - BMA4_ACCEL_RANGE_2G
@@ -614,56 +1027,65 @@ void Watchy::_bmaConfig(){
             - BMA4_ACCEL_RES_AVG64
             - BMA4_ACCEL_RES_AVG128
     */
-    cfg.bandwidth = BMA4_ACCEL_NORMAL_AVG4;
-
+    cfg.bandwidth = BMA4_ACCEL_OSR4_AVG1;
     /*! Filter performance mode , Optional parameters:
         - BMA4_CIC_AVG_MODE
         - BMA4_CONTINUOUS_MODE
     */
-    cfg.perf_mode = BMA4_CONTINUOUS_MODE;
-
-    // Configure the BMA423 accelerometer
-    sensor.setAccelConfig(cfg);
+    cfg.perf_mode = BMA4_CIC_AVG_MODE;
 
-    // Enable BMA423 accelerometer
-    // Warning : Need to use feature, you must first enable the accelerometer
-    // Warning : Need to use feature, you must first enable the accelerometer
-    sensor.enableAccel();
+    bool stepCounter = true;
+    bool gestures = false;
+    bool powerSave = true;
 
-    struct bma4_int_pin_config config ;
-    config.edge_ctrl = BMA4_LEVEL_TRIGGER;
-    config.lvl = BMA4_ACTIVE_HIGH;
-    config.od = BMA4_PUSH_PULL;
-    config.output_en = BMA4_OUTPUT_ENABLE;
-    config.input_en = BMA4_INPUT_DISABLE;
-    // The correct trigger interrupt needs to be configured as needed
-    sensor.setINTPinConfig(config, BMA4_INTR1_MAP);
+    switch(profile){
+        case ACCEL_PROFILE_ULTRA_LOW:
+            stepCounter = false;
+            break;
+        case ACCEL_PROFILE_STEP_ONLY:
+            break;
+        case ACCEL_PROFILE_INTERACTIVE:
+            cfg.odr = BMA4_OUTPUT_DATA_RATE_100HZ;
+            gestures = true;
+            break;
+        case ACCEL_PROFILE_HIGH_RATE:
+            cfg.odr = BMA4_OUTPUT_DATA_RATE_200HZ;
+            cfg.bandwidth = BMA4_ACCEL_NORMAL_AVG4;
+            cfg.perf_mode = BMA4_CONTINUOUS_MODE;
+            gestures = true;
+            powerSave = false;
+            break;
+        default:
+            break;
+    }
 
-    struct bma423_axes_remap remap_data;
-    remap_data.x_axis = 1;
-    remap_data.x_axis_sign = 0xFF;
-    remap_data.y_axis = 0;
-    remap_data.y_axis_sign = 0xFF;
-    remap_data.z_axis = 2;
-    remap_data.z_axis_sign = 0xFF;
-    // Need to raise the wrist function, need to set the correct axis
-    sensor.setRemapAxes(&remap_data);
+    if(profile != ACCEL_PROFILE_ULTRA_LOW){
+        // Configure the BMA423 accelerometer
+        sensor.setAccelConfig(cfg);
+        // Warning : Need to use feature, you must first enable the accelerometer
+        sensor.enableAccel();
+    }
 
-    // Enable BMA423 isStepCounter feature
-    sensor.enableFeature(BMA423_STEP_CNTR, true);
-    // Enable BMA423 isTilt feature
-    sensor.enableFeature(BMA423_TILT, true);
-    // Enable BMA423 isDoubleClick feature
-    sensor.enableFeature(BMA423_WAKEUP, true);
+    // Enable BMA423 step counter, tilt and double tap (wakeup) features
+    sensor.enableFeature(BMA423_STEP_CNTR, stepCounter);
+    sensor.enableFeature(BMA423_TILT, gestures);
+    sensor.enableFeature(BMA423_WAKEUP, gestures);
+    //INT1 is reserved for gesture wake and steps are polled, unless the ULP counts pulses on it
+    sensor.enableStepCountInterrupt(stepCounter && backgroundSensing);
+    if(stepCounter && backgroundSensing){
+        sensor.setStepCountWatermark(1);
+    }
+    sensor.enableTiltInterrupt(gestures);
+    // It corresponds to isDoubleClick interrupt
+    sensor.enableWakeupInterrupt(gestures);
 
-    // Reset steps
-    sensor.resetStepCounter();
+    if(profile == ACCEL_PROFILE_ULTRA_LOW){
+        sensor.disableAccel();
+    }
 
-    // Turn on feature interrupt
-    sensor.enableStepCountInterrupt();
-    sensor.enableTiltInterrupt();
-    // It corresponds to isDoubleClick interrupt
-    sensor.enableWakeupInterrupt();
+    if(powerSave){
+        sensor.shutDown(); //advanced power save, duty cycles the accel between samples
+    }
 }
 
 void Watchy::setupWifi(){
@@ -683,7 +1105,7 @@ void Watchy::setupWifi(){
         display.println("Connected to");
         display.println(WiFi.SSID());
     }
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
     //turn off radios
     WiFi.mode(WIFI_OFF);
     btStop();
@@ -702,7 +1124,7 @@ void Watchy::_configModeCallback (WiFiManager *myWiFiManager) {
     display.println(WIFI_AP_SSID);
     display.print("IP: ");
     display.println(WiFi.softAPIP());
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
 }
 
 bool Watchy::connectWiFi(){
@@ -736,7 +1158,7 @@ void Watchy::showUpdateFW(){
     display.println("again when ready");
     display.println(" ");
     display.println("Keep USB powered");
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
 
     guiState = FW_UPDATE_STATE;
 }
@@ -753,7 +1175,7 @@ void Watchy::updateFWBegin(){
     display.println(" ");
     display.println("Waiting for");
     display.println("connection...");
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
 
     BLE BT;
     BT.begin("Watchy BLE OTA");
@@ -773,7 +1195,7 @@ void Watchy::updateFWBegin(){
         display.println(" ");
         display.println("Waiting for");
         display.println("upload...");
-        display.display(false); //full refresh
+        display.display(true); //partial refresh
         }
         if(currentStatus == 1){
         display.setFullWindow();
@@ -798,7 +1220,7 @@ void Watchy::updateFWBegin(){
         display.println("completed!");
         display.println(" ");
         display.println("Rebooting...");
-        display.display(false); //full refresh
+        display.display(true); //partial refresh
 
         delay(2000);
         esp_restart();
@@ -812,7 +1234,7 @@ void Watchy::updateFWBegin(){
         display.println("BLE Disconnected!");
         display.println(" ");
         display.println("exiting...");
-        display.display(false); //full refresh
+        display.display(true); //partial refresh
         delay(1000);
         break;
         }
@@ -824,7 +1246,7 @@ void Watchy::updateFWBegin(){
     //turn off radios
     WiFi.mode(WIFI_OFF);
     btStop();
-    showMenu(false);
+    showMenu(true);
 }
 
 void Watchy::showSyncNTP() {
@@ -834,7 +1256,7 @@ void Watchy::showSyncNTP() {
     display.setTextColor(GxEPD_WHITE);
     display.setCursor(0, 30);
     display.println("Syncing NTP... ");
-    display.display(false); //full refresh
+    display.display(true); //partial refresh
     if(connectWiFi()) {
         if(syncNTP()) {
             display.println("NTP Sync Success\n");
@@ -864,9 +1286,9 @@ void Watchy::showSyncNTP() {
     }else{
         display.println("WiFi Not Configured");
     }
-    display.display(true); //full refresh
+    display.display(true); //partial refresh
     //delay(3000);
-    showMenu(false);
+    showMenu(true);
 }
 
 bool Watchy::syncNTP(long gmt, int dst, String ntpServer){ //NTP sync - call after connecting to WiFi and remember to turn it back off
@@ -12,6 +12,12 @@
 #include <Fonts/FreeMonoBold9pt7b.h>
 #include "DSEG7_Classic_Bold_53.h"
 #include "WatchyRTC.h"
+#include "WatchyDisplay.h"
+#include "WatchyI2C.h"
+#include "WatchyProfiler.h"
+#include "WatchyWakeStub.h"
+#include "WatchyULP.h"
+#include "WatchyApp.h"
 #include "BLE.h"
 #include "bma.h"
 #include "config.h"
@@ -25,30 +31,79 @@ struct watchySettings {
     int dstOffset;
 };
 
+class Watchy;
+typedef void (Watchy::*menuHandler)();
+
+struct menuItem {
+    const char *label;
+    menuHandler handler; //called when the item is picked, a face's own method needs a static_cast<menuHandler>
+    const uint8_t *icon; //MENU_ICON_SIZE square bitmap left of the label, nullptr for none
+};
+
+typedef void (Watchy::*wakeHandler)();
+
+struct wakeAction {
+    uint8_t events; //WAKE_EVENT_* bits the handler runs on
+    uint8_t needs; //WAKE_NEEDS_* subsystems brought up before it runs, others stay off unless it asks with require
+    wakeHandler handler;
+};
+
+//menu rows are laid out at compile time: baseline of the label and the band the highlight fills
+constexpr int16_t menuBaseline(uint8_t row){ return 30 + MENU_HEIGHT * row; }
+constexpr int16_t menuRowTop(uint8_t row){ return menuBaseline(row) - 22; }
+constexpr int16_t MENU_ROW_HEIGHT = MENU_HEIGHT - 2;
+constexpr int16_t MENU_LABEL_X = MENU_ICON_SIZE + 4; //labels of items with an icon
 
 
 class Watchy {
     public:
         static WatchyRTC RTC;
-        static GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> display;
+        static WatchyDisplay display;
         tmElements_t currentTime;
         watchySettings settings;
     public:
         explicit Watchy(const watchySettings& s) : settings(s) {};
         void init(String datetime = "");
         void deepSleep();
+        //run a handler on wakes matching events, after the needs are up (up to WAKE_EXTRA_HANDLERS). Handlers run in
+        //the order they were added, after the built in ones, e.g. a headless step logger on WAKE_EVENT_TIMER
+        bool addWakeHandler(uint8_t events, uint8_t needs, wakeHandler handler);
+        void require(uint8_t needs); //bring up the WAKE_NEEDS_* subsystems that are not up yet this wake
+        uint8_t getWakeEvents(); //WAKE_EVENT_* bits of the wake in progress
         static void displayBusyCallback(const void*);
         float getBatteryVoltage();
         void vibMotor(uint8_t intervalMs = 100, uint8_t length = 20);
+        void setAccelProfile(uint8_t profile); //ACCEL_PROFILE_*, persists across deep sleep
+        uint8_t getAccelProfile();
+        void setGestureWake(bool enable); //wake from deep sleep on accelerometer gestures
+        bool getGestureWake();
+        //while asleep the ULP counts BMA423 INT1 pulses, one per 20 steps and any gesture, and reads the battery
+        //(see WatchyULP). INT1 is then no longer a gesture wake: the cores wake with WAKE_EVENT_SENSOR after
+        //pulseWake pulses since the previous wake, or once when the battery drops below batteryWakeMv. 0 turns either off
+        void setBackgroundSensing(bool enable, uint16_t pulseWake = 0, uint16_t batteryWakeMv = 0);
+        bool getBackgroundSensing();
+        uint16_t getSensorPulses(); //INT1 pulses the ULP counted between the previous wake and this one
+        //watch face ticks from start:00 to end:00 are left to the wake stub, the face keeps the last time drawn.
+        //Equal hours turn it off
+        void setQuietHours(uint8_t start, uint8_t end);
+        //CPU frequency for the wake and while the face draws, e.g. from a face's constructor. The trade-off
+        //shows in WatchyProfiler::last, per PROFILE_PHASE_*
+        void setCpuFrequencies(uint32_t ioMhz, uint32_t drawMhz);
+        void setFastRefresh(bool fast); //partial refreshes use the fast waveform (see WatchyEPD), off on every wake
+        bool getFastRefresh();
 
         void runUI();
         uint64_t readButtonState();
         void showMenu(bool partialRefresh);
+        //append an item to the main menu (up to MENU_EXTRA_ITEMS), e.g. from a face's constructor
+        bool addMenuItem(const char *label, menuHandler handler, const uint8_t *icon = nullptr);
         void showBattery();
         void showBuzz();
         void showAccelerometer();
         void showUpdateFW();
         void setTime();
+        //run an app until it closes, then go back to the menu
+        void runApp(WatchyApp &app);
         void showSyncNTP();
         void setupWifi();
         bool connectWiFi();
@@ -64,11 +119,53 @@ class Watchy {
 
         void showWatchFace(bool partialRefresh);
         virtual void drawWatchFace(); //override this method for different watch faces
+        //Override to draw the parts of the face that rarely change and return true, they are then cached
+        //(compressed, in RTC memory) and each showWatchFace starts from a copy before calling drawWatchFace.
+        //The cache is redrawn when watchFaceBackgroundKey changes or after invalidateBackground
+        virtual bool drawWatchFaceBackground();
+        virtual uint32_t watchFaceBackgroundKey();
+        void invalidateBackground();
+        //Override to redraw only what changed since the last tick and return true. On a partial refresh the
+        //buffer then holds the frame the panel shows (see FRAME_RETAIN_SIZE) instead of a blank one, and only
+        //the changed area is sent. Return false before drawing anything to get a full drawWatchFace
+        virtual bool updateWatchFace();
         void showAltFace(bool partialRefresh);
         virtual void drawAltFace();
+        virtual void onDoubleTap(); //override these methods to handle accelerometer gestures
+        virtual void onTilt();
+        virtual void onSensorWake(); //override to handle WAKE_EVENT_SENSOR, refreshes the watch face by default
 
     private:
+        static const wakeAction WAKE_ACTIONS[]; //built in handlers, extras follow them
+        wakeAction _wakeExtras[WAKE_EXTRA_HANDLERS];
+        uint8_t _wakeExtraCount = 0;
+        uint8_t _wakeEvents = 0;
+        uint8_t _ready = 0; //WAKE_NEEDS_* bits brought up this wake
+        uint16_t _sensorPulses = 0;
+        uint32_t _ioMhz = CPU_IO_MHZ;
+        uint32_t _drawMhz = CPU_DRAW_MHZ;
+        void _beginPhase(uint8_t phase);
+        String _resetTime; //init's datetime, set on reset
+        static uint8_t _decodeWake();
+        void _onReset();
+        void _onAlarm();
+        uint16_t _quietTicks();
+        uint8_t _batteryPin();
+        static const menuItem MENU_ITEMS[]; //built in items, extras follow them
+        static const uint8_t MENU_BUILTIN_ITEMS;
+        menuItem _menuExtras[MENU_EXTRA_ITEMS];
+        uint8_t _menuExtraCount = 0;
+        uint8_t _menuLength();
+        const menuItem& _menuItem(uint8_t index);
+        void _drawMenuRow(uint8_t row, uint8_t index);
+        void _drawMenuScrollBar();
+        void _moveMenuSelection(int previous);
+        void _syncNow();
+        void _lightSleep(uint64_t held, uint32_t waitMs);
         void _bmaConfig();
+        void _applyAccelProfile(uint8_t profile);
+        void _handleAccelInterrupt();
+        void _drawBackground();
         static void _configModeCallback(WiFiManager *myWiFiManager);
         static uint16_t _readRegister(uint8_t address, uint8_t reg, uint8_t *data, uint16_t len);
         static uint16_t _writeRegister(uint8_t address, uint8_t reg, uint8_t *data, uint16_t len);
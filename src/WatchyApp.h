@@ -0,0 +1,33 @@
+#ifndef WATCHY_APP_H
+#define WATCHY_APP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+class Watchy;
+
+//A screen run by Watchy::runApp. The event loop light sleeps until a button goes down or the next tick is due,
+//calls the hook and sends the refresh region to the panel (only the bytes that changed, see WatchyDisplay::display).
+//Hooks draw into Watchy::display without calling display() themselves
+class WatchyApp {
+    public:
+        virtual ~WatchyApp() {}
+        //draw the whole screen
+        virtual void onEnter(Watchy &watchy) {}
+        //buttons newly pressed (or held for APP_BUTTON_REPEAT_MS) as *_BTN_MASK bits, return false to close the app.
+        //By default BACK closes it
+        virtual bool onButton(Watchy &watchy, uint64_t buttons) { return !(buttons & BACK_BTN_MASK); }
+        virtual void onTick(Watchy &watchy) {}
+        virtual void onExit(Watchy &watchy) {}
+        //ms between onTick calls, 0 for none
+        virtual uint32_t tickInterval() { return 0; }
+        //the part of the screen onButton and onTick redraw, nothing outside it is sent
+        virtual void refreshRegion(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+            x = 0;
+            y = 0;
+            w = DISPLAY_WIDTH;
+            h = DISPLAY_HEIGHT;
+        }
+};
+
+#endif
@@ -0,0 +1,834 @@
+#include "WatchyDisplay.h"
+#include <rom/crc.h>
+
+RTC_DATA_ATTR uint32_t WatchyDisplay::_shownFrameCRC;
+RTC_DATA_ATTR bool WatchyDisplay::_shownFrameValid = false;
+RTC_DATA_ATTR uint8_t WatchyDisplay::_partialRefreshes[REGION_ROWS * REGION_COLS];
+RTC_DATA_ATTR bool WatchyDisplay::_fullRefreshRequested = false;
+#if FRAME_RETAIN_SIZE > 0
+RTC_DATA_ATTR uint8_t WatchyDisplay::_shownFrame[FRAME_RETAIN_SIZE];
+RTC_DATA_ATTR uint16_t WatchyDisplay::_shownFrameLength = 0;
+#endif
+
+WatchyDisplay::WatchyDisplay(const WatchyEPD& epd2_instance)
+    : Adafruit_GFX(DISPLAY_WIDTH, DISPLAY_HEIGHT), epd2(epd2_instance) {
+    memset(_glyphCaches, 0, sizeof(_glyphCaches));
+    setFullWindow();
+}
+
+void WatchyDisplay::init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode){
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+    setFullWindow();
+}
+
+void WatchyDisplay::display(bool partial_update_mode){
+    //a window refresh counts towards the ghosting budget too, once it is spent the whole buffer gets the full refresh
+    if(partial_update_mode && _usingPartialWindow && !_fullRefreshDue()){
+#if FRAME_RETAIN_SIZE > 0
+        int16_t x = _pw_x, y = _pw_y, w = _pw_w, h = _pw_h;
+        if(_shownFrameValid && _shownFrameLength > 0 && _clipWindow(x, y, w, h)){
+            //if everything that changed is inside the window the retained frame stays in sync
+            int16_t cx, cy, cw, ch;
+            _shownFrameChanged(cx, cy, cw, ch);
+            if(cw == 0){
+                WatchyProfiler::current.displayRefreshesSkipped++;
+                return;
+            }
+            //the changed area comes in whole bytes, compare the window's byte-aligned bounds
+            if((cx & ~7) >= (x & ~7) && cy >= y && ((cx + cw + 7) & ~7) <= ((x + w + 7) & ~7) && cy + ch <= y + h){
+                _pushWindow(cx, cy, cw, ch);
+                _retainShownFrame(crc32_le(0, _buffer, BUFFER_SIZE));
+                return;
+            }
+        }
+#endif
+        displayWindow(_pw_x, _pw_y, _pw_w, _pw_h);
+        return;
+    }
+    uint32_t crc = crc32_le(0, _buffer, BUFFER_SIZE);
+    if(partial_update_mode && _shownFrameValid && crc == _shownFrameCRC){
+        WatchyProfiler::current.displayRefreshesSkipped++;
+        return; //nothing changed, skip the transfer and the refresh
+    }
+    if(partial_update_mode && _fullRefreshDue()){
+        partial_update_mode = false; //clear the ghosting left by the partial refreshes
+    }
+#if FRAME_RETAIN_SIZE > 0
+    if(partial_update_mode && _shownFrameValid && _shownFrameLength > 0){
+        //the panel outside the changed area already shows the buffer, send just that area
+        int16_t x, y, w, h;
+        _shownFrameChanged(x, y, w, h);
+        if(w == 0){
+            WatchyProfiler::current.displayRefreshesSkipped++;
+        }else{
+            _pushWindow(x, y, w, h);
+        }
+        _retainShownFrame(crc);
+        return;
+    }
+#endif
+    WatchyProfiler::current.displayRefreshes++;
+    _retainShownFrame(crc);
+    uint32_t start = micros();
+    if(partial_update_mode){
+        _countPartialRefresh(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        epd2.writeImage(_buffer, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }else{
+        memset(_partialRefreshes, 0, sizeof(_partialRefreshes));
+        _fullRefreshRequested = false;
+        epd2.writeImageForFullRefresh(_buffer, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+    uint32_t written = micros();
+    epd2.refresh(partial_update_mode);
+    uint32_t refreshed = micros();
+    if(epd2.hasFastPartialUpdate){
+        epd2.writeImageAgain(_buffer, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+    WatchyProfiler::current.displayUploadMicros += (written - start) + (micros() - refreshed);
+    WatchyProfiler::current.displayRefreshMicros += refreshed - written;
+    if(!partial_update_mode){
+        epd2.powerOff();
+    }
+}
+
+//x and w are widened to byte boundaries by the controller
+void WatchyDisplay::displayWindow(int16_t x, int16_t y, int16_t w, int16_t h){
+    if(!_clipWindow(x, y, w, h)){
+        return;
+    }
+    _shownFrameValid = false; //the panel outside the window may not match the buffer
+    _pushWindow(x, y, w, h);
+}
+
+//the next partial display() is done as a full refresh
+void WatchyDisplay::requestFullRefresh(){
+    _fullRefreshRequested = true;
+}
+
+bool WatchyDisplay::_fullRefreshDue(){
+    if(_fullRefreshRequested){
+        return true;
+    }
+    for(uint8_t count : _partialRefreshes){
+        if(count >= GHOSTING_BUDGET){
+            return true;
+        }
+    }
+    return false;
+}
+
+//x, y, w, h in panel coordinates. The fast waveform ghosts more, it counts twice
+void WatchyDisplay::_countPartialRefresh(int16_t x, int16_t y, int16_t w, int16_t h){
+    uint8_t weight = epd2.getFastRefresh() ? 2 : 1;
+    for(int16_t row = y / REFRESH_REGION_SIZE; row <= (y + h - 1) / REFRESH_REGION_SIZE; row++){
+        for(int16_t col = x / REFRESH_REGION_SIZE; col <= (x + w - 1) / REFRESH_REGION_SIZE; col++){
+            uint8_t &count = _partialRefreshes[row * REGION_COLS + col];
+            count = min(count + weight, 255);
+        }
+    }
+}
+
+bool WatchyDisplay::restoreShownFrame(){
+#if FRAME_RETAIN_SIZE > 0
+    if(_shownFrameValid && _shownFrameLength > 0){
+        unpackBuffer(_shownFrame, _shownFrameLength);
+        return true;
+    }
+#endif
+    return false;
+}
+
+//clip a window to the screen and rotate it to panel coordinates, false if nothing is left
+bool WatchyDisplay::_clipWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h){
+    x = min(max(x, (int16_t)0), width());
+    y = min(max(y, (int16_t)0), height());
+    w = min(w, (int16_t)(width() - x));
+    h = min(h, (int16_t)(height() - y));
+    if(w <= 0 || h <= 0){
+        return false;
+    }
+    _rotate(x, y, w, h);
+    return true;
+}
+
+//x, y, w, h in panel coordinates
+void WatchyDisplay::_pushWindow(int16_t x, int16_t y, int16_t w, int16_t h){
+    WatchyProfiler::current.displayRefreshes++;
+    _countPartialRefresh(x, y, w, h);
+    uint32_t start = micros();
+    epd2.writeImagePart(_buffer, x, y, DISPLAY_WIDTH, DISPLAY_HEIGHT, x, y, w, h);
+    uint32_t written = micros();
+    epd2.refresh(x, y, w, h);
+    uint32_t refreshed = micros();
+    if(epd2.hasFastPartialUpdate){
+        epd2.writeImagePartAgain(_buffer, x, y, DISPLAY_WIDTH, DISPLAY_HEIGHT, x, y, w, h);
+    }
+    WatchyProfiler::current.displayUploadMicros += (written - start) + (micros() - refreshed);
+    WatchyProfiler::current.displayRefreshMicros += refreshed - written;
+}
+
+//bounding box of the bytes that differ from the retained frame, in panel coordinates, w is 0 if none do.
+//The retained frame is compared run by run without unpacking it
+void WatchyDisplay::_shownFrameChanged(int16_t &x, int16_t &y, int16_t &w, int16_t &h){
+    int16_t firstRow = DISPLAY_HEIGHT, lastRow = -1;
+    int16_t firstCol = WIDTH_BYTES, lastCol = -1;
+#if FRAME_RETAIN_SIZE > 0
+    const uint8_t *in = _shownFrame;
+    const uint8_t *end = _shownFrame + _shownFrameLength;
+    uint16_t o = 0;
+    while(in < end && o < BUFFER_SIZE){
+        int8_t n = (int8_t)*in++;
+        if(n == -128){
+            continue;
+        }
+        bool repeat = (n < 0);
+        uint16_t count = min((uint16_t)(repeat ? 1 - n : n + 1), (uint16_t)(BUFFER_SIZE - o));
+        uint8_t value = repeat ? *in++ : 0;
+        for(uint16_t k = 0; k < count; k++){
+            if(_buffer[o + k] != (repeat ? value : in[k])){
+                int16_t row = (o + k) / WIDTH_BYTES;
+                int16_t col = (o + k) % WIDTH_BYTES;
+                firstRow = min(firstRow, row);
+                lastRow = max(lastRow, row);
+                firstCol = min(firstCol, col);
+                lastCol = max(lastCol, col);
+            }
+        }
+        if(!repeat){
+            in += n + 1;
+        }
+        o += count;
+    }
+#endif
+    if(lastRow < 0){
+        x = y = w = h = 0;
+        return;
+    }
+    x = firstCol * 8;
+    y = firstRow;
+    w = (lastCol - firstCol + 1) * 8;
+    h = lastRow - firstRow + 1;
+}
+
+//the buffer was pushed in full (or everything that changed was), keep its CRC and a compressed copy
+void WatchyDisplay::_retainShownFrame(uint32_t crc){
+    _shownFrameCRC = crc;
+    _shownFrameValid = true;
+#if FRAME_RETAIN_SIZE > 0
+    _shownFrameLength = packBuffer(_shownFrame, FRAME_RETAIN_SIZE); //stays 0 if it doesn't fit
+#endif
+}
+
+void WatchyDisplay::setFullWindow(){
+    _usingPartialWindow = false;
+    _pw_x = 0;
+    _pw_y = 0;
+    _pw_w = DISPLAY_WIDTH;
+    _pw_h = DISPLAY_HEIGHT;
+}
+
+//the whole buffer stays addressable, the window only limits what display(true) sends
+void WatchyDisplay::setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h){
+    _usingPartialWindow = true;
+    _pw_x = x;
+    _pw_y = y;
+    _pw_w = w;
+    _pw_h = h;
+}
+
+void WatchyDisplay::powerOff(){
+    epd2.powerOff();
+}
+
+void WatchyDisplay::hibernate(){
+    epd2.hibernate();
+}
+
+uint8_t* WatchyDisplay::getBuffer(){
+    return _buffer;
+}
+
+uint16_t WatchyDisplay::packBuffer(uint8_t *out, uint16_t capacity){
+    uint16_t o = 0;
+    uint16_t i = 0;
+    while(i < BUFFER_SIZE){
+        uint16_t run = 1;
+        while(i + run < BUFFER_SIZE && run < 128 && _buffer[i + run] == _buffer[i]){
+            run++;
+        }
+        if(run >= 2){
+            if(o + 2 > capacity){
+                return 0;
+            }
+            out[o++] = (uint8_t)(1 - run);
+            out[o++] = _buffer[i];
+            i += run;
+            continue;
+        }
+        //literal until the next pair of equal bytes
+        uint16_t start = i;
+        while(i < BUFFER_SIZE && i - start < 128 && !(i + 1 < BUFFER_SIZE && _buffer[i] == _buffer[i + 1])){
+            i++;
+        }
+        uint16_t length = i - start;
+        if(o + 1 + length > capacity){
+            return 0;
+        }
+        out[o++] = length - 1;
+        memcpy(out + o, _buffer + start, length);
+        o += length;
+    }
+    return o;
+}
+
+void WatchyDisplay::unpackBuffer(const uint8_t *in, uint16_t length){
+    const uint8_t *end = in + length;
+    uint16_t o = 0;
+    while(in < end && o < BUFFER_SIZE){
+        int8_t n = (int8_t)*in++;
+        if(n == -128){
+            continue;
+        }
+        uint16_t count = min((uint16_t)(n < 0 ? 1 - n : n + 1), (uint16_t)(BUFFER_SIZE - o));
+        if(n < 0){
+            memset(_buffer + o, *in++, count);
+        }else{
+            memcpy(_buffer + o, in, count);
+            in += n + 1;
+        }
+        o += count;
+    }
+}
+
+void WatchyDisplay::drawPixel(int16_t x, int16_t y, uint16_t color){
+    if((x < 0) || (x >= width()) || (y < 0) || (y >= height())){
+        return;
+    }
+    int16_t t;
+    switch(getRotation()){
+        case 1:
+            t = x; x = y; y = t;
+            x = DISPLAY_WIDTH - x - 1;
+            break;
+        case 2:
+            x = DISPLAY_WIDTH - x - 1;
+            y = DISPLAY_HEIGHT - y - 1;
+            break;
+        case 3:
+            t = x; x = y; y = t;
+            y = DISPLAY_HEIGHT - y - 1;
+            break;
+    }
+    uint16_t i = x / 8 + y * WIDTH_BYTES;
+    if(color == GxEPD_WHITE){
+        _buffer[i] |= (0x80 >> (x & 7));
+    }else{
+        _buffer[i] &= ~(0x80 >> (x & 7));
+    }
+}
+
+void WatchyDisplay::fillScreen(uint16_t color){
+    memset(_buffer, (color == GxEPD_WHITE) ? 0xFF : 0x00, BUFFER_SIZE);
+}
+
+void WatchyDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+    if(w < 0){
+        x += w + 1;
+        w = -w;
+    }
+    if(h < 0){
+        y += h + 1;
+        h = -h;
+    }
+    if(x < 0){
+        w += x;
+        x = 0;
+    }
+    if(y < 0){
+        h += y;
+        y = 0;
+    }
+    w = min(w, (int16_t)(width() - x));
+    h = min(h, (int16_t)(height() - y));
+    if(w <= 0 || h <= 0){
+        return;
+    }
+    _rotate(x, y, w, h);
+    if(x == 0 && w == DISPLAY_WIDTH){
+        memset(_buffer + y * WIDTH_BYTES, (color == GxEPD_WHITE) ? 0xFF : 0x00, h * WIDTH_BYTES);
+        return;
+    }
+    for(int16_t row = y; row < y + h; row++){
+        _fillSpan(x, x + w - 1, row, color);
+    }
+}
+
+void WatchyDisplay::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+    fillRect(x, y, w, h, color);
+}
+
+void WatchyDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+    fillRect(x, y, w, 1, color);
+}
+
+void WatchyDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+    fillRect(x, y, 1, h, color);
+}
+
+void WatchyDisplay::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+    fillRect(x, y, w, 1, color);
+}
+
+void WatchyDisplay::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+    fillRect(x, y, 1, h, color);
+}
+
+//Adafruit_GFX::writeLine walks every step from one end to the other. Here the range of steps i whose major
+//coordinate (x after the steep swap) is on screen is narrowed by the steps whose minor coordinate is, then the
+//walk starts at the first of them with the error term Adafruit's loop would have there.
+//After i steps the minor coordinate has moved n(i) = max(0, ceil((i * dy - dx / 2) / dx)) times
+void WatchyDisplay::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+    int16_t t;
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if(steep){
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if(x0 > x1){
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    int32_t dx = x1 - x0;
+    int32_t dy = abs(y1 - y0);
+    int32_t err0 = dx / 2;
+    int16_t ystep = (y0 < y1) ? 1 : -1;
+    int32_t xMax = (steep ? height() : width()) - 1;
+    int32_t yMax = (steep ? width() : height()) - 1;
+
+    int32_t first = max((int32_t)0, (int32_t)-x0);
+    int32_t last = min(dx, xMax - x0);
+    //the minor coordinate is y0 + ystep * n, on screen for nLo <= n <= nHi
+    int32_t nLo = (ystep > 0) ? -y0 : y0 - yMax;
+    int32_t nHi = (ystep > 0) ? yMax - y0 : y0;
+    if(nHi < 0){
+        return;
+    }
+    if(dy == 0){
+        if(nLo > 0){
+            return;
+        }
+    }else{
+        //first step at which n(i) reaches m >= 1
+        auto firstStep = [&](int32_t m){
+            return (int32_t)(((int64_t)(m - 1) * dx + err0) / dy + 1);
+        };
+        if(nLo > 0){
+            first = max(first, firstStep(nLo));
+        }
+        last = min(last, firstStep(nHi + 1) - 1);
+    }
+    if(first > last){
+        return;
+    }
+    int64_t moved = (int64_t)first * dy - err0;
+    int32_t n = (moved > 0) ? (int32_t)((moved + dx - 1) / dx) : 0;
+    int32_t err = (int32_t)(err0 - (int64_t)first * dy + (int64_t)n * dx);
+    int16_t y = y0 + ystep * n;
+    bool white = (color == GxEPD_WHITE);
+    for(int32_t x = x0 + first; x <= x0 + last; x++){
+        if(getRotation() != 0){
+            drawPixel(steep ? y : x, steep ? x : y, color);
+        }else{ //every step left is on screen, set the bit directly
+            int16_t px = steep ? y : x;
+            uint8_t *p = _buffer + (steep ? x : y) * WIDTH_BYTES + (px >> 3);
+            uint8_t bit = 0x80 >> (px & 7);
+            *p = white ? (*p | bit) : (*p & ~bit);
+        }
+        err -= dy;
+        if(err < 0){
+            y += ystep;
+            err += dx;
+        }
+    }
+}
+
+size_t WatchyDisplay::write(uint8_t c){
+    const uint8_t *bitmap = nullptr;
+    if(getRotation() == 0 && textsize_x == 1 && textsize_y == 1){
+        bitmap = _cachedGlyph(c);
+    }
+    if(bitmap == nullptr){
+        return Adafruit_GFX::write(c);
+    }
+    //same cursor handling as Adafruit_GFX::write for custom fonts
+    GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+    if(wrap && (cursor_x + glyph->xOffset + glyph->width) > _width){
+        cursor_x = 0;
+        cursor_y += gfxFont->yAdvance;
+    }
+    _blit(cursor_x + glyph->xOffset, cursor_y + glyph->yOffset, bitmap, nullptr, glyph->width, glyph->height, textcolor, textcolor, BLIT_TRANSPARENT);
+    cursor_x += glyph->xAdvance;
+    return 1;
+}
+
+void WatchyDisplay::cacheGlyphs(const GFXfont *font, const char *chars){
+    for(glyphCache &cache : _glyphCaches){
+        if(cache.font == font){
+            return;
+        }
+        if(cache.font == nullptr){
+            cache.font = font;
+            cache.chars = chars;
+            return;
+        }
+    }
+}
+
+const uint8_t* WatchyDisplay::_cachedGlyph(uint8_t c){
+    if(gfxFont == nullptr || c < gfxFont->first || c > gfxFont->last){
+        return nullptr;
+    }
+    for(glyphCache &cache : _glyphCaches){
+        if(cache.font != gfxFont){
+            continue;
+        }
+        const char *pos = strchr(cache.chars, c);
+        if(c == 0 || pos == nullptr || pos - cache.chars >= GLYPH_CACHE_CHARS){
+            return nullptr;
+        }
+        uint8_t index = pos - cache.chars;
+        if(cache.bitmaps[index] == nullptr){
+            //unpack the bit stream of the glyph into rows padded to whole bytes
+            GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+            uint8_t w = glyph->width;
+            uint8_t h = glyph->height;
+            uint8_t stride = (w + 7) / 8;
+            if(w == 0 || h == 0){
+                return nullptr;
+            }
+            uint8_t *bitmap = (uint8_t *)calloc(stride * h, 1);
+            if(bitmap == nullptr){
+                return nullptr;
+            }
+            const uint8_t *src = gfxFont->bitmap + glyph->bitmapOffset;
+            uint8_t bits = 0;
+            uint16_t bit = 0;
+            for(uint8_t yy = 0; yy < h; yy++){
+                for(uint8_t xx = 0; xx < w; xx++){
+                    if(!(bit++ & 7)){
+                        bits = *src++;
+                    }
+                    if(bits & 0x80){
+                        bitmap[yy * stride + xx / 8] |= 0x80 >> (xx & 7);
+                    }
+                    bits <<= 1;
+                }
+            }
+            cache.bitmaps[index] = bitmap;
+        }
+        return cache.bitmaps[index];
+    }
+    return nullptr;
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color){
+    if(getRotation() != 0){
+        Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+        return;
+    }
+    _blit(x, y, bitmap, nullptr, w, h, color, color, BLIT_TRANSPARENT);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg){
+    if(getRotation() != 0){
+        Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+        return;
+    }
+    _blit(x, y, bitmap, nullptr, w, h, color, bg, BLIT_OPAQUE);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color){
+    drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg){
+    drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+}
+
+void WatchyDisplay::drawBitmapMasked(int16_t x, int16_t y, const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h, uint16_t color, uint16_t bg){
+    _blit(x, y, bitmap, mask, w, h, color, bg, BLIT_MASKED);
+}
+
+//Blit a bitmap with rows padded to whole bytes (Adafruit/PROGMEM layout) into the buffer.
+//Each source byte is shifted across two buffer bytes, only the bits past w in the last byte of a row are masked off
+void WatchyDisplay::_blit(int16_t x, int16_t y, const uint8_t *bitmap, const uint8_t *mask, int16_t w, int16_t h, uint16_t color, uint16_t bg, uint8_t mode){
+    int16_t stride = (w + 7) / 8;
+    if(w <= 0 || h <= 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || x + w <= 0 || y + h <= 0){
+        return;
+    }
+    if(getRotation() != 0 || x < 0 || x + w > DISPLAY_WIDTH){ //straddles the left or right edge, clip pixel by pixel
+        for(int16_t j = 0; j < h; j++){
+            for(int16_t i = 0; i < w; i++){
+                uint8_t bit = 0x80 >> (i & 7);
+                uint16_t index = j * stride + i / 8;
+                if(mode == BLIT_MASKED && !(mask[index] & bit)){
+                    continue;
+                }
+                if(bitmap[index] & bit){
+                    drawPixel(x + i, y + j, color);
+                }else if(mode != BLIT_TRANSPARENT){
+                    drawPixel(x + i, y + j, bg);
+                }
+            }
+        }
+        return;
+    }
+    int16_t firstRow = y < 0 ? -y : 0;
+    int16_t lastRow = y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT - y : h;
+    uint8_t shift = x & 7;
+    uint8_t fgBits = (color == GxEPD_WHITE) ? 0xFF : 0x00;
+    uint8_t bgBits = (bg == GxEPD_WHITE) ? 0xFF : 0x00;
+    uint8_t edgeMask = 0xFF << ((8 - (w & 7)) & 7); //valid bits of the last byte in a row
+
+    if(mode == BLIT_OPAQUE && shift == 0 && (w & 7) == 0){
+        //byte aligned opaque rows are the panel format already, copy (or invert) whole rows
+        uint8_t *dst = _buffer + (y + firstRow) * WIDTH_BYTES + (x >> 3);
+        const uint8_t *src = bitmap + firstRow * stride;
+        int16_t rows = lastRow - firstRow;
+        bool contiguous = (stride == WIDTH_BYTES);
+        int16_t runs = contiguous ? 1 : rows;
+        size_t runLength = contiguous ? (size_t)stride * rows : stride;
+        for(int16_t r = 0; r < runs; r++){
+            if(fgBits == bgBits){
+                memset(dst, fgBits, runLength);
+            }else if(fgBits){
+                memcpy(dst, src, runLength);
+            }else{
+                size_t i = 0;
+                for(; i + 4 <= runLength; i += 4){ //a word at a time, memcpy keeps unaligned flash reads legal
+                    uint32_t word;
+                    memcpy(&word, src + i, 4);
+                    word = ~word;
+                    memcpy(dst + i, &word, 4);
+                }
+                for(; i < runLength; i++){
+                    dst[i] = ~src[i];
+                }
+            }
+            dst += WIDTH_BYTES;
+            src += stride;
+        }
+        return;
+    }
+
+    for(int16_t j = firstRow; j < lastRow; j++){
+        const uint8_t *src = bitmap + j * stride;
+        const uint8_t *msk = (mode == BLIT_MASKED) ? mask + j * stride : nullptr;
+        uint8_t *dst = _buffer + (y + j) * WIDTH_BYTES + (x >> 3);
+        for(int16_t i = 0; i < stride; i++){
+            uint8_t s = src[i];
+            uint8_t m = (mode == BLIT_TRANSPARENT) ? s : (mode == BLIT_MASKED) ? msk[i] : 0xFF;
+            if(i == stride - 1){
+                m &= edgeMask;
+            }
+            if(m == 0){
+                continue;
+            }
+            uint8_t v = (s & fgBits) | (~s & bgBits);
+            uint16_t m16 = ((uint16_t)m << 8) >> shift;
+            uint16_t v16 = ((uint16_t)v << 8) >> shift;
+            uint8_t mHi = m16 >> 8;
+            uint8_t mLo = m16 & 0xFF;
+            dst[i] = (dst[i] & ~mHi) | ((v16 >> 8) & mHi);
+            if(mLo){
+                dst[i + 1] = (dst[i + 1] & ~mLo) | (v16 & mLo);
+            }
+        }
+    }
+}
+
+void WatchyDisplay::drawBitmapRLE(int16_t x, int16_t y, const uint8_t data[], int16_t w, int16_t h, uint16_t color){
+    _blitRLE(x, y, data, w, h, color, color, BLIT_TRANSPARENT);
+}
+
+void WatchyDisplay::drawBitmapRLE(int16_t x, int16_t y, const uint8_t data[], int16_t w, int16_t h, uint16_t color, uint16_t bg){
+    _blitRLE(x, y, data, w, h, color, bg, BLIT_OPAQUE);
+}
+
+//PackBits: a header byte n of 0..127 is followed by n+1 literal bytes, -127..-1 by one byte repeated 1-n times, -128 is a no-op.
+//Runs may cross row boundaries. A byte aligned opaque bitmap is decoded straight into its place in the buffer,
+//anything else is decoded a row at a time and blitted
+void WatchyDisplay::_blitRLE(int16_t x, int16_t y, const uint8_t *data, int16_t w, int16_t h, uint16_t color, uint16_t bg, uint8_t mode){
+    int16_t stride = (w + 7) / 8;
+    if(w <= 0 || h <= 0 || stride > WIDTH_BYTES){
+        return;
+    }
+    bool direct = (mode == BLIT_OPAQUE && getRotation() == 0 && (x & 7) == 0 && (w & 7) == 0 && x >= 0 && x + w <= DISPLAY_WIDTH);
+    uint8_t fgBits = (color == GxEPD_WHITE) ? 0xFF : 0x00;
+    uint8_t bgBits = (bg == GxEPD_WHITE) ? 0xFF : 0x00;
+    uint8_t row[WIDTH_BYTES]; //scratch row, also swallows rows clipped off the top or bottom in direct mode
+    int16_t i = 0;
+    int16_t j = 0;
+    while(j < h){
+        int8_t n = (int8_t)*data++;
+        if(n == -128){
+            continue;
+        }
+        bool repeat = (n < 0);
+        int16_t count = repeat ? 1 - n : n + 1;
+        uint8_t value = repeat ? *data++ : 0;
+        while(count > 0 && j < h){
+            int16_t chunk = min(count, (int16_t)(stride - i));
+            bool onScreen = (y + j >= 0 && y + j < DISPLAY_HEIGHT);
+            if(direct && onScreen){
+                uint8_t *dst = _buffer + (y + j) * WIDTH_BYTES + (x >> 3) + i;
+                if(repeat){
+                    memset(dst, (value & fgBits) | (~value & bgBits), chunk);
+                }else{
+                    for(int16_t k = 0; k < chunk; k++){
+                        dst[k] = (data[k] & fgBits) | (~data[k] & bgBits);
+                    }
+                }
+            }else if(repeat){
+                memset(row + i, value, chunk);
+            }else{
+                memcpy(row + i, data, chunk);
+            }
+            if(!repeat){
+                data += chunk;
+            }
+            count -= chunk;
+            i += chunk;
+            if(i == stride){
+                if(!direct && onScreen){
+                    _blit(x, y + j, row, nullptr, w, 1, color, bg, mode);
+                }
+                i = 0;
+                j++;
+            }
+        }
+    }
+}
+
+void WatchyDisplay::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
+    if(r < 0 || x0 + r < 0 || x0 - r >= width() || y0 + r < 0 || y0 - r >= height()){
+        return;
+    }
+    if(getRotation() != 0){
+        Adafruit_GFX::fillCircle(x0, y0, r, color);
+        return;
+    }
+    //rows of the circle on screen, as distances k from the center row
+    int16_t yLo = max((int16_t)(y0 - r), (int16_t)0);
+    int16_t yHi = min((int16_t)(y0 + r), (int16_t)(DISPLAY_HEIGHT - 1));
+    int16_t kLo = (yLo <= y0 && y0 <= yHi) ? 0 : min(abs(yLo - y0), abs(yHi - y0));
+    int16_t kHi = max(abs(yLo - y0), abs(yHi - y0));
+    //Run the midpoint loop of Adafruit_GFX::fillCircleHelper without drawing. Each step fills column x0 +- c
+    //for rows within h of y0, keep the widest c per h, the half width of row k is then the widest c for any h >= k
+    int16_t widest[DISPLAY_HEIGHT];
+    int16_t beyond = -1; //widest c for h > kHi
+    for(int16_t k = 0; k <= kHi - kLo; k++){
+        widest[k] = -1;
+    }
+    auto column = [&](int16_t c, int16_t h){
+        if(h > kHi){
+            beyond = max(beyond, c);
+        }else if(h >= kLo){
+            widest[h - kLo] = max(widest[h - kLo], c);
+        }
+    };
+    column(0, r);
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+    while(x < y){
+        if(f >= 0){
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if(x < (y + 1)){
+            column(x, y);
+        }
+        if(y != py){
+            column(py, px);
+            py = y;
+        }
+        px = x;
+    }
+    for(int16_t k = kHi - kLo; k >= 0; k--){
+        beyond = max(beyond, widest[k]);
+        widest[k] = beyond;
+    }
+    for(int16_t row = yLo; row <= yHi; row++){
+        int16_t c = widest[abs(row - y0) - kLo];
+        _fillSpan(x0 - c, x0 + c, row, color);
+    }
+}
+
+void WatchyDisplay::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
+    if(r < 0 || x0 + r < 0 || x0 - r >= width() || y0 + r < 0 || y0 - r >= height() || _circleCoversScreen(x0, y0, r)){
+        return;
+    }
+    Adafruit_GFX::drawCircle(x0, y0, r, color);
+}
+
+//true if the whole screen is well inside the circle, so its outline is off screen
+bool WatchyDisplay::_circleCoversScreen(int16_t x0, int16_t y0, int16_t r){
+    int32_t dx = max(abs(x0), abs(width() - 1 - x0)) + 1;
+    int32_t dy = max(abs(y0), abs(height() - 1 - y0)) + 1;
+    return dx * dx + dy * dy < (int32_t)(r - 1) * (r - 1);
+}
+
+//fill x0..x1 (inclusive) of buffer row y, a byte at a time between the partial end bytes
+void WatchyDisplay::_fillSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color){
+    if(y < 0 || y >= DISPLAY_HEIGHT){
+        return;
+    }
+    x0 = max(x0, (int16_t)0);
+    x1 = min(x1, (int16_t)(DISPLAY_WIDTH - 1));
+    if(x0 > x1){
+        return;
+    }
+    uint8_t *row = _buffer + y * WIDTH_BYTES;
+    uint8_t bits = (color == GxEPD_WHITE) ? 0xFF : 0x00;
+    int16_t first = x0 >> 3;
+    int16_t last = x1 >> 3;
+    uint8_t firstMask = 0xFF >> (x0 & 7);
+    uint8_t lastMask = 0xFF << (7 - (x1 & 7));
+    if(first == last){
+        firstMask &= lastMask;
+        row[first] = (row[first] & ~firstMask) | (bits & firstMask);
+        return;
+    }
+    row[first] = (row[first] & ~firstMask) | (bits & firstMask);
+    memset(row + first + 1, bits, last - first - 1);
+    row[last] = (row[last] & ~lastMask) | (bits & lastMask);
+}
+
+void WatchyDisplay::_rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h){
+    int16_t t;
+    switch(getRotation()){
+        case 1:
+            t = x; x = y; y = t;
+            t = w; w = h; h = t;
+            x = DISPLAY_WIDTH - x - w;
+            break;
+        case 2:
+            x = DISPLAY_WIDTH - x - w;
+            y = DISPLAY_HEIGHT - y - h;
+            break;
+        case 3:
+            t = x; x = y; y = t;
+            t = w; w = h; h = t;
+            y = DISPLAY_HEIGHT - y - h;
+            break;
+    }
+}
@@ -0,0 +1,117 @@
+#ifndef WATCHY_DISPLAY_H
+#define WATCHY_DISPLAY_H
+
+#include <Arduino.h>
+#include <GxEPD2_BW.h>
+#include "config.h"
+#include "WatchyProfiler.h"
+#include "WatchyEPD.h"
+
+#define GLYPH_CACHE_FONTS 4
+#define GLYPH_CACHE_CHARS 12
+//blit modes
+#define BLIT_TRANSPARENT 0 //set bits in color, clear bits untouched
+#define BLIT_OPAQUE 1 //set bits in color, clear bits in bg
+#define BLIT_MASKED 2 //like opaque, limited to the set bits of a mask
+
+//Full screen 1bpp frame buffer for the 200x200 panel, drop-in for GxEPD2_BW<GxEPD2_154_D67, HEIGHT>.
+//Owning the buffer lets the drawing fast paths write whole bytes instead of going through drawPixel.
+//Buffer layout matches the panel RAM: row major, MSB is the leftmost pixel, 1 = white
+class WatchyDisplay : public Adafruit_GFX {
+    public:
+        static const uint16_t WIDTH_BYTES = DISPLAY_WIDTH / 8;
+        static const uint16_t BUFFER_SIZE = WIDTH_BYTES * DISPLAY_HEIGHT;
+        WatchyEPD epd2;
+    public:
+        explicit WatchyDisplay(const WatchyEPD& epd2_instance);
+        void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode);
+        //a partial refresh is skipped if the buffer matches the frame the panel shows (by CRC, kept across deep sleep).
+        //If that frame is retained (FRAME_RETAIN_SIZE) only the bounding box of the changed bytes is sent.
+        //With a partial window set, changes confined to it keep the retained frame, otherwise the window is sent as is.
+        //A partial refresh is upgraded to a full one once a region of the panel used up GHOSTING_BUDGET
+        //partial refreshes, or after requestFullRefresh
+        void display(bool partial_update_mode = false);
+        void requestFullRefresh();
+        void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+        void setFullWindow();
+        void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+        void powerOff();
+        void hibernate();
+        uint8_t* getBuffer();
+        //PackBits compress the whole buffer into out, returns the compressed length or 0 if it doesn't fit in capacity
+        uint16_t packBuffer(uint8_t *out, uint16_t capacity);
+        //restore the buffer from packBuffer's output
+        void unpackBuffer(const uint8_t *in, uint16_t length);
+        //load the frame the panel shows into the buffer to draw over it, false if it wasn't retained
+        bool restoreShownFrame();
+
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+        void fillScreen(uint16_t color) override;
+        //rects and straight lines are clipped and filled as byte wide spans
+        void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+        void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+        void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+        void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+        void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+        void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+        //same pixels as Adafruit_GFX, only the steps that land on screen are walked
+        void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+        size_t write(uint8_t c) override;
+        using Print::write;
+
+        //same as Adafruit_GFX::drawBitmap, but blits whole bytes into the buffer.
+        //A byte aligned opaque bitmap (e.g. a full screen background) is a straight copy
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+        void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
+        void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+        //only pixels with a set bit in mask are touched, those are drawn in color or bg like the opaque drawBitmap
+        void drawBitmapMasked(int16_t x, int16_t y, const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+        //PackBits compressed bitmap (tools/imgconv.py --rle), decoded straight into the buffer.
+        //Bitmaps up to the display width are supported
+        void drawBitmapRLE(int16_t x, int16_t y, const uint8_t data[], int16_t w, int16_t h, uint16_t color);
+        void drawBitmapRLE(int16_t x, int16_t y, const uint8_t data[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+
+        //same pixels as Adafruit_GFX, clipped to the screen first so off-screen parts of huge circles cost nothing.
+        //Filled circles are drawn as byte wide spans
+        void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+        void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+        //pre-rasterize chars of a GFX font into byte aligned bitmaps on first use,
+        //text in that font is then blitted a row at a time instead of pixel by pixel
+        void cacheGlyphs(const GFXfont *font, const char *chars = "0123456789:");
+    private:
+        struct glyphCache {
+            const GFXfont *font;
+            const char *chars;
+            uint8_t *bitmaps[GLYPH_CACHE_CHARS];
+        };
+        uint8_t _buffer[BUFFER_SIZE];
+        static uint32_t _shownFrameCRC; //CRC of the buffer last pushed in full
+        static bool _shownFrameValid; //false until a full push, or after a windowed one
+        static const uint8_t REGION_COLS = (DISPLAY_WIDTH + REFRESH_REGION_SIZE - 1) / REFRESH_REGION_SIZE;
+        static const uint8_t REGION_ROWS = (DISPLAY_HEIGHT + REFRESH_REGION_SIZE - 1) / REFRESH_REGION_SIZE;
+        static uint8_t _partialRefreshes[REGION_ROWS * REGION_COLS]; //since the last full refresh, kept across deep sleep
+        static bool _fullRefreshRequested;
+#if FRAME_RETAIN_SIZE > 0
+        static uint8_t _shownFrame[FRAME_RETAIN_SIZE]; //PackBits copy of the buffer last pushed in full
+        static uint16_t _shownFrameLength; //0 if it didn't fit or isn't valid
+#endif
+        glyphCache _glyphCaches[GLYPH_CACHE_FONTS];
+        bool _usingPartialWindow;
+        int16_t _pw_x, _pw_y, _pw_w, _pw_h;
+        const uint8_t* _cachedGlyph(uint8_t c);
+        void _blit(int16_t x, int16_t y, const uint8_t *bitmap, const uint8_t *mask, int16_t w, int16_t h, uint16_t color, uint16_t bg, uint8_t mode);
+        void _fillSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+        bool _circleCoversScreen(int16_t x0, int16_t y0, int16_t r);
+        void _blitRLE(int16_t x, int16_t y, const uint8_t *data, int16_t w, int16_t h, uint16_t color, uint16_t bg, uint8_t mode);
+        void _rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+        bool _clipWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+        void _pushWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+        void _shownFrameChanged(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+        void _retainShownFrame(uint32_t crc);
+        bool _fullRefreshDue();
+        void _countPartialRefresh(int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+#endif
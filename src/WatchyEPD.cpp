@@ -0,0 +1,216 @@
+#include "WatchyEPD.h"
+
+//SSD1681 register LUT: 5 voltage groups of 12 bytes, 12 timing groups of 7, frame rate and gate timing 9 (0x32),
+//then end option (0x3F), gate voltage (0x03), source voltages (0x04, 3 bytes) and VCOM (0x2C).
+//Group 0 drives only the changed pixels (BW, WB) to their new state for 15 frames, unchanged ones see no voltage.
+//Group 1 then drives every pixel, unchanged BB and WW included, one frame towards its state and idles one frame
+static const uint8_t FAST_LUT[159] PROGMEM = {
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,
+    0x02, 0x17, 0x41, 0xB0, 0x32, 0x28,
+};
+
+RTC_DATA_ATTR bool WatchyEPD::_ramRetained = false;
+
+WatchyEPD::WatchyEPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+    : GxEPD2_154_D67(cs, dc, rst, busy), _fastRefresh(false) {
+    _spi_settings = SPISettings(DISPLAY_SPI_CLOCK_HZ, MSBFIRST, SPI_MODE0);
+}
+
+void WatchyEPD::init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode){
+    GxEPD2_154_D67::init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode); //the hardware reset wakes the controller
+    if(initial || !_ramRetained){
+        return; //GxEPD2 runs its full init sequence before the first transfer
+    }
+    //the hardware reset restored the register defaults and kept the RAM, skip the SW reset (0x12) and
+    //driver output control (0x01, the default is already 200 gates)
+    _waitWhileBusy("resume", 1);
+    _writeCommand(0x3C); //border waveform
+    _writeData(0x05);
+    _writeCommand(0x18); //internal temperature sensor
+    _writeData(0x80);
+    _init_display_done = true;
+    //GxEPD2's partial refresh runs _Init_Part, the SW reset included, unless it is already in partial mode.
+    //Its update sequence (0x22 0xFC) turns the clock and analog on, the power stays off until then
+    _using_partial_mode = true;
+    _power_is_on = false;
+    WatchyProfiler::current.displayResumes++;
+}
+
+void WatchyEPD::hibernate(){
+    GxEPD2_154_D67::hibernate(); //deep sleep mode 1 (0x10 0x01), RAM retained
+    _ramRetained = _hibernating;
+}
+
+void WatchyEPD::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    if(!_canBulkWrite(bitmap, x, y, w, h, x, y, w, h, invert, mirror_y, pgm)){
+        GxEPD2_154_D67::writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+        return;
+    }
+    _bulkWrite(0x24, bitmap, x, y, w, h);
+}
+
+void WatchyEPD::writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    if(!_canBulkWrite(bitmap, x, y, w, h, x, y, w, h, invert, mirror_y, pgm)){
+        GxEPD2_154_D67::writeImageForFullRefresh(bitmap, x, y, w, h, invert, mirror_y, pgm);
+        return;
+    }
+    _bulkWrite(0x26, bitmap, x, y, w, h); //previous
+    _bulkWrite(0x24, bitmap, x, y, w, h); //current
+}
+
+void WatchyEPD::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    if(!_canBulkWrite(bitmap, x, y, w, h, x, y, w, h, invert, mirror_y, pgm)){
+        GxEPD2_154_D67::writeImageAgain(bitmap, x, y, w, h, invert, mirror_y, pgm);
+        return;
+    }
+    _bulkWrite(0x26, bitmap, x, y, w, h);
+    _bulkWrite(0x24, bitmap, x, y, w, h);
+}
+
+void WatchyEPD::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                               int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    if(!_canBulkWrite(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm)){
+        GxEPD2_154_D67::writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+        return;
+    }
+    _bulkWrite(0x24, bitmap, x, y, w, h);
+}
+
+void WatchyEPD::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                                    int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    if(!_canBulkWrite(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm)){
+        GxEPD2_154_D67::writeImagePartAgain(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+        return;
+    }
+    _bulkWrite(0x26, bitmap, x, y, w, h);
+    _bulkWrite(0x24, bitmap, x, y, w, h);
+}
+
+//The bulk path covers what WatchyDisplay sends: a window of a full screen RAM bitmap at the same position,
+//to a controller that is already initialized. Anything else (first write after power up, flags) goes to GxEPD2
+bool WatchyEPD::_canBulkWrite(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                              int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm){
+    return _init_display_done && !_initial_write && !invert && !mirror_y && !pgm
+        && w_bitmap == WIDTH && h_bitmap == HEIGHT && x_part == x && y_part == y
+        && x >= 0 && y >= 0 && w > 0 && h > 0 && x + w <= WIDTH && y + h <= HEIGHT;
+}
+
+void WatchyEPD::_bulkWrite(uint8_t command, const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h){
+    //widen to whole bytes like GxEPD2
+    w += x % 8;
+    if(w % 8 > 0){
+        w += 8 - w % 8;
+    }
+    x -= x % 8;
+    uint16_t widthBytes = WIDTH / 8;
+    _setRamArea(x, y, w, h);
+    _writeCommand(command);
+    _startTransfer();
+    if(w == WIDTH){ //whole rows are contiguous in the bitmap
+        _pSPIx->writeBytes(bitmap + y * widthBytes, (uint32_t)h * widthBytes);
+    }else{
+        for(int16_t row = y; row < y + h; row++){
+            _pSPIx->writeBytes(bitmap + row * widthBytes + x / 8, w / 8);
+        }
+    }
+    _endTransfer();
+}
+
+void WatchyEPD::setFastRefresh(bool fast){
+    _fastRefresh = fast;
+}
+
+bool WatchyEPD::getFastRefresh(){
+    return _fastRefresh;
+}
+
+void WatchyEPD::refresh(bool partial_update_mode){
+    if(!partial_update_mode || !_fastRefresh || _initial_refresh || !_init_display_done){
+        GxEPD2_154_D67::refresh(partial_update_mode);
+        return;
+    }
+    _setRamArea(0, 0, WIDTH, HEIGHT);
+    _updateFast();
+}
+
+void WatchyEPD::refresh(int16_t x, int16_t y, int16_t w, int16_t h){
+    if(!_fastRefresh || _initial_refresh || !_init_display_done){
+        GxEPD2_154_D67::refresh(x, y, w, h);
+        return;
+    }
+    //same clipping as GxEPD2_154_D67::refresh, x and w widened to whole bytes
+    int16_t x1 = max(x, (int16_t)0);
+    int16_t y1 = max(y, (int16_t)0);
+    int16_t w1 = min((int16_t)(x + w), (int16_t)WIDTH) - x1;
+    int16_t h1 = min((int16_t)(y + h), (int16_t)HEIGHT) - y1;
+    if(w1 <= 0 || h1 <= 0){
+        return;
+    }
+    w1 += x1 % 8;
+    if(w1 % 8 > 0){
+        w1 += 8 - w1 % 8;
+    }
+    x1 -= x1 % 8;
+    _setRamArea(x1, y1, w1, h1);
+    _updateFast();
+}
+
+//GxEPD2_154_D67::_setPartialRamArea is private
+void WatchyEPD::_setRamArea(int16_t x, int16_t y, int16_t w, int16_t h){
+    _writeCommand(0x11); //data entry mode: x increase, y increase
+    _writeData(0x03);
+    _writeCommand(0x44);
+    _writeData(x / 8);
+    _writeData((x + w - 1) / 8);
+    _writeCommand(0x45);
+    _writeData(y % 256);
+    _writeData(y / 256);
+    _writeData((y + h - 1) % 256);
+    _writeData((y + h - 1) / 256);
+    _writeCommand(0x4E);
+    _writeData(x / 8);
+    _writeCommand(0x4F);
+    _writeData(y % 256);
+    _writeData(y / 256);
+}
+
+void WatchyEPD::_updateFast(){
+    //the LUT is sent every time, any stock refresh in between has replaced it with the OTP one
+    _writeCommand(0x32);
+    for(uint8_t i = 0; i < 153; i++){
+        _writeData(pgm_read_byte(&FAST_LUT[i]));
+    }
+    _writeCommand(0x3F);
+    _writeData(pgm_read_byte(&FAST_LUT[153]));
+    _writeCommand(0x03);
+    _writeData(pgm_read_byte(&FAST_LUT[154]));
+    _writeCommand(0x04);
+    _writeData(pgm_read_byte(&FAST_LUT[155]));
+    _writeData(pgm_read_byte(&FAST_LUT[156]));
+    _writeData(pgm_read_byte(&FAST_LUT[157]));
+    _writeCommand(0x2C);
+    _writeData(pgm_read_byte(&FAST_LUT[158]));
+    _writeCommand(0x22); //clock and analog on, display mode 2 with the register LUT, no OTP load
+    _writeData(0xCC);
+    _writeCommand(0x20);
+    _waitWhileBusy("_updateFast", partial_refresh_time / 2);
+    _power_is_on = true;
+    _using_partial_mode = true;
+}
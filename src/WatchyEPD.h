@@ -0,0 +1,46 @@
+#ifndef WATCHY_EPD_H
+#define WATCHY_EPD_H
+
+#include <Arduino.h>
+#include <GxEPD2_BW.h>
+#include "config.h"
+#include "WatchyProfiler.h"
+
+//GxEPD2_154_D67 (SSD1681) with a fast partial refresh waveform and bulk frame uploads.
+//SPI runs at DISPLAY_SPI_CLOCK_HZ, frames are sent with SPIClass::writeBytes a row span (or the whole window) at a time
+//instead of GxEPD2's transfer per byte.
+//While fast refresh is on, partial refreshes load a short LUT from registers instead of the OTP one: about half
+//the latency, at the cost of contrast and more ghosting. Stock refreshes reload the OTP LUT, so turning it off
+//needs no command
+class WatchyEPD : public GxEPD2_154_D67 {
+    public:
+        WatchyEPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy);
+        //if the controller was left in deep sleep mode 1 by hibernate, its RAM still holds the last frame:
+        //a non initial init only sets the registers the hardware reset cleared, instead of the full SW reset sequence
+        void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10, bool pulldown_rst_mode = false) override;
+        void hibernate() override;
+        //same as GxEPD2_154_D67, bulk transfers once the controller is initialized
+        using GxEPD2_154_D67::writeImage;
+        using GxEPD2_154_D67::writeImagePart;
+        void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false) override;
+        void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+        void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+        void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                            int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false) override;
+        void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                                 int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+        void setFastRefresh(bool fast);
+        bool getFastRefresh();
+        void refresh(bool partial_update_mode = false) override;
+        void refresh(int16_t x, int16_t y, int16_t w, int16_t h) override;
+    private:
+        bool _fastRefresh;
+        static bool _ramRetained; //the controller sleeps with the shown frame in its RAM, kept across deep sleep
+        void _setRamArea(int16_t x, int16_t y, int16_t w, int16_t h);
+        void _updateFast();
+        bool _canBulkWrite(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                           int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm);
+        void _bulkWrite(uint8_t command, const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "WatchyI2C.h"
+
+void WatchyI2C::begin(){
+    pinMode(SDA, INPUT_PULLUP);
+    if(digitalRead(SDA) == LOW){ //a slave was reset mid transfer and is holding SDA
+        recoverBus();
+    }
+    Wire.begin(SDA, SCL, I2C_CLOCK_HZ);
+    Wire.setClock(I2C_CLOCK_HZ); //begin() keeps the old clock if a library already started the bus
+}
+
+void WatchyI2C::recoverBus(){
+    WatchyProfiler::current.i2cRecoveries++;
+    Wire.end();
+    pinMode(SDA, INPUT_PULLUP);
+    pinMode(SCL, OUTPUT_OPEN_DRAIN);
+    digitalWrite(SCL, HIGH);
+    //clock the stuck slave through the rest of its byte until it releases SDA
+    for(int i = 0; i < I2C_RECOVERY_CLOCKS && digitalRead(SDA) == LOW; i++){
+        digitalWrite(SCL, LOW);
+        delayMicroseconds(5);
+        digitalWrite(SCL, HIGH);
+        delayMicroseconds(5);
+    }
+    //generate a STOP condition so every slave is back to idle
+    pinMode(SDA, OUTPUT_OPEN_DRAIN);
+    digitalWrite(SDA, LOW);
+    delayMicroseconds(5);
+    digitalWrite(SCL, HIGH);
+    delayMicroseconds(5);
+    digitalWrite(SDA, HIGH);
+    delayMicroseconds(5);
+    Wire.begin(SDA, SCL, I2C_CLOCK_HZ);
+}
+
+uint8_t WatchyI2C::readRegisters(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len){
+    uint8_t error = _read(address, reg, data, len);
+    if(error != 0){
+        WatchyProfiler::current.i2cErrors++;
+        if(_shouldRecover(error)){
+            recoverBus();
+            error = _read(address, reg, data, len);
+        }
+    }
+    return error;
+}
+
+uint8_t WatchyI2C::writeRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len){
+    uint8_t error = _write(address, reg, data, len);
+    if(error != 0){
+        WatchyProfiler::current.i2cErrors++;
+        if(_shouldRecover(error)){
+            recoverBus();
+            error = _write(address, reg, data, len);
+        }
+    }
+    return error;
+}
+
+uint8_t WatchyI2C::probe(uint8_t address){
+    WatchyProfiler::current.i2cTransactions++;
+    Wire.beginTransmission(address);
+    return Wire.endTransmission(); //a NACK here just means the chip isn't fitted, not an error
+}
+
+uint8_t WatchyI2C::_read(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len){
+    WatchyProfiler::current.i2cTransactions++;
+    WatchyProfiler::current.i2cBytes += len + 1;
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    uint8_t error = Wire.endTransmission(false); //repeated start, hold the bus for the read
+    if(error != 0){
+        return error;
+    }
+    if(Wire.requestFrom(address, len) != len){
+        return 4; //other error, same code Wire uses
+    }
+    for(uint8_t i = 0; i < len; i++){
+        data[i] = Wire.read();
+    }
+    return 0;
+}
+
+uint8_t WatchyI2C::_write(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len){
+    WatchyProfiler::current.i2cTransactions++;
+    WatchyProfiler::current.i2cBytes += len + 1;
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    Wire.write(data, len);
+    return Wire.endTransmission();
+}
+
+bool WatchyI2C::_shouldRecover(uint8_t error){
+    //1-3 are buffer overflow and NACKs, the slave answered so the bus is fine.
+    //4 (other) and 5 (timeout) usually mean SDA or SCL is held
+    return error >= 4;
+}
@@ -0,0 +1,25 @@
+#ifndef WATCHY_I2C_H
+#define WATCHY_I2C_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "config.h"
+#include "WatchyProfiler.h"
+
+//Register level I2C access shared by the RTC and BMA423 drivers.
+//Each call is a single bus transaction (register address + burst), return value is the Wire error code, 0 on success.
+//A transaction that fails with a bus error or timeout recovers the bus and is retried once
+class WatchyI2C {
+    public:
+        static void begin(); //recover the bus if needed and start it at I2C_CLOCK_HZ
+        static void recoverBus();
+        static uint8_t readRegisters(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len);
+        static uint8_t writeRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len);
+        static uint8_t probe(uint8_t address);
+    private:
+        static uint8_t _read(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len);
+        static uint8_t _write(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len);
+        static bool _shouldRecover(uint8_t error);
+};
+
+#endif
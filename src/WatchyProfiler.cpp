@@ -0,0 +1,47 @@
+#include "WatchyProfiler.h"
+#include "config.h"
+
+wakeProfile WatchyProfiler::current;
+RTC_DATA_ATTR wakeProfile WatchyProfiler::last;
+uint8_t WatchyProfiler::_phase;
+uint32_t WatchyProfiler::_phaseStart;
+uint32_t WatchyProfiler::_phaseSleepStart;
+uint32_t WatchyProfiler::_phaseMhz;
+
+void WatchyProfiler::begin(){
+    memset(&current, 0, sizeof(current));
+    _phase = PROFILE_PHASE_IO;
+    _phaseStart = micros();
+    _phaseSleepStart = 0;
+    _phaseMhz = getCpuFrequencyMhz();
+}
+
+void WatchyProfiler::end(){
+    _endPhase();
+    current.wakeMicros = micros();
+    last = current;
+}
+
+void WatchyProfiler::beginPhase(uint8_t phase){
+    _endPhase();
+    _phase = phase;
+    _phaseStart = micros();
+    _phaseSleepStart = current.sleepMicros;
+    _phaseMhz = getCpuFrequencyMhz();
+}
+
+void WatchyProfiler::slept(uint32_t duration){
+    current.sleepMicros += duration;
+}
+
+void WatchyProfiler::_endPhase(){
+    uint32_t elapsed = micros() - _phaseStart;
+    uint32_t sleep = min(elapsed, current.sleepMicros - _phaseSleepStart);
+    current.phaseMicros[_phase] += elapsed;
+    //uA * us * mV is 1e-15 J
+    uint64_t femtojoules = ((uint64_t)(elapsed - sleep) * (ENERGY_ACTIVE_BASE_UA + ENERGY_ACTIVE_UA_PER_MHZ * _phaseMhz) +
+                           (uint64_t)sleep * ENERGY_LIGHT_SLEEP_UA) * ENERGY_SUPPLY_MV;
+    current.phaseMicrojoules[_phase] += femtojoules / 1000000000ULL;
+    _phaseStart = micros();
+    _phaseSleepStart = current.sleepMicros;
+}
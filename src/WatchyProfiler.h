@@ -0,0 +1,46 @@
+#ifndef WATCHY_PROFILER_H
+#define WATCHY_PROFILER_H
+
+#include <Arduino.h>
+
+//phases of a wake, each runs at its own CPU frequency (see Watchy::setCpuFrequencies)
+#define PROFILE_PHASE_IO 0 //sensors, networking, frame upload and waiting on the panel
+#define PROFILE_PHASE_DRAW 1 //drawing the watch face into the frame buffer
+#define PROFILE_PHASES 2
+
+struct wakeProfile {
+    uint8_t wakeEvents; //WAKE_EVENT_* bits that caused the wake
+    uint32_t wakeMicros; //from boot to deep sleep
+    uint16_t stubWakes; //alarm wakes the wake stub handled since the previous wake of the app
+    uint16_t i2cTransactions; //a burst read or write counts as one transaction
+    uint16_t i2cBytes; //bytes moved over I2C, including register addresses
+    uint16_t i2cErrors; //transactions that failed, including ones that succeeded on retry
+    uint16_t i2cRecoveries; //times the bus was clocked out and restarted
+    uint16_t displayRefreshes; //panel refreshes, full, partial or windowed
+    uint16_t displayRefreshesSkipped; //partial refreshes skipped because the panel already showed the frame
+    uint16_t displayResumes; //controller woken with its RAM intact, without the full init sequence
+    uint32_t displayUploadMicros; //writing frames into the controller RAM
+    uint32_t displayRefreshMicros; //waiting for the panel to refresh
+    uint32_t sleepMicros; //light sleep while awake, waiting on the panel or a button
+    uint32_t phaseMicros[PROFILE_PHASES]; //from init to deep sleep, light sleep included
+    uint32_t phaseMicrojoules[PROFILE_PHASES]; //estimated from the time, CPU frequency and light sleep (ENERGY_*)
+};
+
+class WatchyProfiler {
+    public:
+        static wakeProfile current; //counters for the wake in progress
+        static wakeProfile last; //counters from the previous wake, kept in RTC memory
+    public:
+        static void begin();
+        static void end();
+        static void beginPhase(uint8_t phase); //PROFILE_PHASE_*, call after changing the CPU frequency
+        static void slept(uint32_t duration); //add a light sleep to the phase in progress
+    private:
+        static uint8_t _phase;
+        static uint32_t _phaseStart;
+        static uint32_t _phaseSleepStart;
+        static uint32_t _phaseMhz;
+        static void _endPhase();
+};
+
+#endif
@@ -1,17 +1,15 @@
 #include "WatchyRTC.h"
 
 WatchyRTC::WatchyRTC()
-    : rtc_ds(false) {}
+    : rtc_ds(false), alarmMinute(0) {}
 
 void WatchyRTC::init(){
     byte error;
-    Wire.beginTransmission(RTC_DS_ADDR);
-    error = Wire.endTransmission();
+    error = WatchyI2C::probe(RTC_DS_ADDR);
     if(error == 0){
         rtcType = DS3231;
     }else{
-        Wire.beginTransmission(RTC_PCF_ADDR);
-        error = Wire.endTransmission();
+        error = WatchyI2C::probe(RTC_PCF_ADDR);
         if(error == 0){
             rtcType = PCF8563;
         }else{
@@ -30,27 +28,54 @@ void WatchyRTC::config(String datetime){ //String datetime format is YYYY:MM:DD:
 
 void WatchyRTC::clearAlarm(){
     if(rtcType == DS3231){
-        rtc_ds.alarm(ALARM_2);
+        uint8_t status;
+        if(WatchyI2C::readRegisters(RTC_DS_ADDR, DS_STATUS_REG, &status, 1) == 0 && (status & DS_STATUS_A2F)){
+            status &= ~DS_STATUS_A2F; //resets the alarm 2 flag in the RTC
+            WatchyI2C::writeRegisters(RTC_DS_ADDR, DS_STATUS_REG, &status, 1);
+        }
     }else{
-        int nextAlarmMinute = 0;
-        rtc_pcf.clearAlarm(); //resets the alarm flag in the RTC
-        nextAlarmMinute = rtc_pcf.getMinute();
+        uint8_t minute;
+        WatchyI2C::readRegisters(RTC_PCF_ADDR, PCF_MINUTES_REG, &minute, 1);
+        int nextAlarmMinute = _bcdToDec(minute & 0x7F);
         nextAlarmMinute = (nextAlarmMinute == 59) ? 0 : (nextAlarmMinute + 1); //set alarm to trigger 1 minute from now
-        rtc_pcf.setAlarm(nextAlarmMinute, 99, 99, 99);
+        //minute, hour, day, weekday alarm registers in one burst, only the minute is matched
+        uint8_t alarm[4] = {_decToBcd(nextAlarmMinute), PCF_ALARM_DISABLE, PCF_ALARM_DISABLE, PCF_ALARM_DISABLE};
+        WatchyI2C::writeRegisters(RTC_PCF_ADDR, PCF_ALARM_MINUTE_REG, alarm, 4);
+        alarmMinute = nextAlarmMinute;
+        uint8_t ctrl2;
+        if(WatchyI2C::readRegisters(RTC_PCF_ADDR, PCF_CTRL2_REG, &ctrl2, 1) == 0){
+            //resets the alarm flag and keeps the alarm interrupt enabled, the timer bits are left alone
+            ctrl2 = (ctrl2 & ~PCF_CTRL2_AF) | PCF_CTRL2_AIE;
+            WatchyI2C::writeRegisters(RTC_PCF_ADDR, PCF_CTRL2_REG, &ctrl2, 1);
+        }
     }
 }
 
 void WatchyRTC::read(tmElements_t &tm){
+    //seconds through years are consecutive on both RTCs, read them in one burst
+    uint8_t regs[7];
     if(rtcType == DS3231){
-        rtc_ds.read(tm);
+        if(WatchyI2C::readRegisters(RTC_DS_ADDR, DS_SECONDS_REG, regs, 7) != 0){
+            return;
+        }
+        tm.Second = _bcdToDec(regs[0] & 0x7F);
+        tm.Minute = _bcdToDec(regs[1] & 0x7F);
+        tm.Hour = _bcdToDec(regs[2] & 0x3F); //24 hour mode
+        tm.Wday = regs[3] & 0x07;
+        tm.Day = _bcdToDec(regs[4] & 0x3F);
+        tm.Month = _bcdToDec(regs[5] & 0x1F);
+        tm.Year = y2kYearToTm(_bcdToDec(regs[6]));
     }else{
-        tm.Year = y2kYearToTm(rtc_pcf.getYear());
-        tm.Month = rtc_pcf.getMonth();
-        tm.Day = rtc_pcf.getDay();
-        tm.Wday = rtc_pcf.getWeekday() + 1;  //TimeLib & DS3231 has Wday range of 1-7, but PCF8563 stores day of week in 0-6 range
-        tm.Hour = rtc_pcf.getHour();
-        tm.Minute = rtc_pcf.getMinute();
-        tm.Second = rtc_pcf.getSecond();
+        if(WatchyI2C::readRegisters(RTC_PCF_ADDR, PCF_SECONDS_REG, regs, 7) != 0){
+            return;
+        }
+        tm.Second = _bcdToDec(regs[0] & 0x7F);
+        tm.Minute = _bcdToDec(regs[1] & 0x7F);
+        tm.Hour = _bcdToDec(regs[2] & 0x3F);
+        tm.Day = _bcdToDec(regs[3] & 0x3F);
+        tm.Wday = (regs[4] & 0x07) + 1;  //TimeLib & DS3231 has Wday range of 1-7, but PCF8563 stores day of week in 0-6 range
+        tm.Month = _bcdToDec(regs[5] & 0x1F);
+        tm.Year = y2kYearToTm(_bcdToDec(regs[6]));
     }
 }
 
@@ -115,6 +140,14 @@ void WatchyRTC::_PCFConfig(String datetime){ //String datetime is YYYY:MM:DD:HH:
     clearAlarm();
 }
 
+uint8_t WatchyRTC::_bcdToDec(uint8_t bcd){
+    return ((bcd >> 4) * 10) + (bcd & 0x0F);
+}
+
+uint8_t WatchyRTC::_decToBcd(uint8_t dec){
+    return ((dec / 10) << 4) | (dec % 10);
+}
+
 String WatchyRTC::_getValue(String data, char separator, int index)
 {
   int found = 0;
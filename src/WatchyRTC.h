@@ -5,6 +5,7 @@
 #include <Rtc_Pcf8563.h>
 #include "config.h"
 #include "time.h"
+#include "WatchyI2C.h"
 
 #define DS3231 0
 #define PCF8563 1
@@ -12,12 +13,25 @@
 #define RTC_PCF_ADDR 0x51
 #define YEAR_OFFSET_DS 1970
 #define YEAR_OFFSET_PCF 2000
+//DS3231 registers
+#define DS_SECONDS_REG 0x00
+#define DS_STATUS_REG 0x0F
+#define DS_STATUS_A2F 0x02
+//PCF8563 registers
+#define PCF_CTRL2_REG 0x01
+#define PCF_SECONDS_REG 0x02
+#define PCF_MINUTES_REG 0x03
+#define PCF_ALARM_MINUTE_REG 0x09
+#define PCF_CTRL2_AIE 0x02
+#define PCF_CTRL2_AF 0x08 //cleared by writing 0, writing 1 leaves a flag as it is
+#define PCF_ALARM_DISABLE 0x80
 
 class WatchyRTC {
     public:
         DS3232RTC rtc_ds;
         Rtc_Pcf8563 rtc_pcf;
         uint8_t rtcType;
+        uint8_t alarmMinute; //minute the PCF8563 alarm was last set to by clearAlarm
     public:
         WatchyRTC();
         void init();
@@ -30,6 +44,8 @@ class WatchyRTC {
         void _DSConfig(String datetime);
         void _PCFConfig(String datetime);
         int _getDayOfWeek(int d, int m, int y);
+        static uint8_t _bcdToDec(uint8_t bcd);
+        static uint8_t _decToBcd(uint8_t dec);
         String _getValue(String data, char separator, int index);
 };
 
@@ -0,0 +1,147 @@
+#include "WatchyULP.h"
+#include <esp32/ulp.h>
+#include <driver/adc.h>
+#include <driver/rtc_io.h>
+#include <esp_adc_cal.h>
+#include <soc/rtc_cntl_reg.h>
+#include <soc/rtc_io_reg.h>
+
+//words at the start of the ULP reserved RTC memory, the ULP only sees their low 16 bits
+enum {
+    ULP_PULSES, //INT1 rising edges since the app last took them
+    ULP_LEVEL, //INT1 at the previous poll
+    ULP_PULSE_WAKE, //wake the cores at this many pulses, 0 never
+    ULP_BATTERY, //last raw battery reading, 0 before the first one
+    ULP_BATTERY_WAKE, //wake the cores on a raw reading below this, 0 never
+    ULP_BATTERY_WAIT, //polls left until the next battery reading
+    ULP_PROGRAM //the program follows the data
+};
+
+//labels
+enum {
+    ULP_NO_PULSE,
+    ULP_READ_BATTERY,
+    ULP_DONE,
+    ULP_WAKE
+};
+
+static RTC_DATA_ATTR bool ulpRunning = false;
+
+void WatchyULP::start(uint8_t batteryPin){
+    adc1_channel_t channel = (adc1_channel_t)digitalPinToAnalogChannel(batteryPin);
+    adc1_config_width(ADC_WIDTH_BIT_12);
+    adc1_config_channel_atten(channel, ADC_ATTEN_DB_11);
+    adc1_ulp_enable();
+
+    gpio_num_t intPin = (gpio_num_t)ACC_INT_1_PIN;
+    rtc_gpio_init(intPin);
+    rtc_gpio_set_direction(intPin, RTC_GPIO_MODE_INPUT_ONLY);
+    int intBit = RTC_GPIO_IN_NEXT_S + rtc_io_number_get(intPin);
+
+    const ulp_insn_t program[] = {
+        I_MOVI(R3, 0), //data base address
+        //count the rising edges of INT1
+        I_RD_REG(RTC_GPIO_IN_REG, intBit, intBit),
+        I_LD(R1, R3, ULP_LEVEL),
+        I_ST(R0, R3, ULP_LEVEL),
+        I_SUBR(R0, R0, R1), //1 on a rising edge, 0 or 0xFFFF otherwise
+        M_BGE(ULP_NO_PULSE, 2),
+        M_BL(ULP_NO_PULSE, 1),
+        I_LD(R1, R3, ULP_PULSES),
+        I_ADDI(R1, R1, 1),
+        I_ST(R1, R3, ULP_PULSES),
+        I_LD(R2, R3, ULP_PULSE_WAKE),
+        I_MOVR(R0, R2),
+        M_BL(ULP_NO_PULSE, 1),
+        I_SUBR(R0, R1, R2), //overflows while below the threshold
+        M_BXF(ULP_NO_PULSE),
+        M_BX(ULP_WAKE),
+        M_LABEL(ULP_NO_PULSE),
+        //read the battery every ULP_BATTERY_POLLS periods
+        I_LD(R0, R3, ULP_BATTERY_WAIT),
+        M_BL(ULP_READ_BATTERY, 1),
+        I_SUBI(R0, R0, 1),
+        I_ST(R0, R3, ULP_BATTERY_WAIT),
+        I_HALT(),
+        M_LABEL(ULP_READ_BATTERY),
+        I_MOVI(R0, ULP_BATTERY_POLLS - 1),
+        I_ST(R0, R3, ULP_BATTERY_WAIT),
+        I_ADC(R1, 0, channel),
+        I_ST(R1, R3, ULP_BATTERY),
+        I_LD(R2, R3, ULP_BATTERY_WAKE),
+        I_MOVR(R0, R2),
+        M_BL(ULP_DONE, 1),
+        I_SUBR(R0, R1, R2), //overflows below the threshold
+        M_BXF(ULP_WAKE),
+        M_LABEL(ULP_DONE),
+        I_HALT(),
+        M_LABEL(ULP_WAKE),
+        I_WAKE(), //ignored while the cores are awake, the app takes the pulses before it sleeps again
+        I_HALT(),
+    };
+    for(int i = 0; i < ULP_PROGRAM; i++){
+        RTC_SLOW_MEM[i] = 0;
+    }
+    size_t size = sizeof(program) / sizeof(ulp_insn_t);
+    if(ulp_process_macros_and_load(ULP_PROGRAM, program, &size) != ESP_OK){
+        return; //larger than the RTC memory the ULP reserves (CONFIG_ESP32_ULP_COPROC_RESERVE_MEM)
+    }
+    ulp_set_wakeup_period(0, ULP_PERIOD_US);
+    ulp_run(ULP_PROGRAM);
+    ulpRunning = true;
+}
+
+void WatchyULP::stop(){
+    //the timer restarts the program, clearing it leaves the ULP halted
+    CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    ulpRunning = false;
+}
+
+bool WatchyULP::running(){
+    return ulpRunning;
+}
+
+void WatchyULP::arm(uint16_t pulseWake, uint16_t batteryWakeMv){
+    uint16_t batteryWake = _rawFromMillivolts(batteryWakeMv);
+    uint16_t battery = RTC_SLOW_MEM[ULP_BATTERY] & 0xFFFF;
+    RTC_SLOW_MEM[ULP_PULSES] = 0; //pulses counted while awake are not from this sleep
+    RTC_SLOW_MEM[ULP_PULSE_WAKE] = pulseWake;
+    RTC_SLOW_MEM[ULP_BATTERY_WAKE] = (battery == 0 || battery >= batteryWake) ? batteryWake : 0;
+    adc1_ulp_enable(); //an analogRead while awake took ADC1 from the ULP
+    //deepSleep switched every pin back to the digital input, hand INT1 back to the ULP
+    rtc_gpio_init((gpio_num_t)ACC_INT_1_PIN);
+    rtc_gpio_set_direction((gpio_num_t)ACC_INT_1_PIN, RTC_GPIO_MODE_INPUT_ONLY);
+}
+
+uint16_t WatchyULP::takePulses(){
+    if(!ulpRunning){
+        return 0;
+    }
+    uint16_t pulses = RTC_SLOW_MEM[ULP_PULSES] & 0xFFFF;
+    RTC_SLOW_MEM[ULP_PULSES] = 0;
+    return pulses;
+}
+
+uint16_t WatchyULP::batteryMillivolts(){
+    uint16_t raw = RTC_SLOW_MEM[ULP_BATTERY] & 0xFFFF;
+    if(!ulpRunning || raw == 0){
+        return 0;
+    }
+    esp_adc_cal_characteristics_t adc;
+    esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &adc);
+    return esp_adc_cal_raw_to_voltage(raw, &adc) * BATTERY_DIVIDER;
+}
+
+//the ULP compares raw readings, invert the linear part of the eFuse calibration
+uint16_t WatchyULP::_rawFromMillivolts(uint16_t mv){
+    if(mv == 0){
+        return 0;
+    }
+    esp_adc_cal_characteristics_t adc;
+    esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &adc);
+    uint32_t pin = mv / BATTERY_DIVIDER;
+    if(pin <= adc.coeff_b){
+        return 1;
+    }
+    return min((uint32_t)4095, ((pin - adc.coeff_b) << 16) / adc.coeff_a);
+}
@@ -0,0 +1,25 @@
+#ifndef WATCHY_ULP_H
+#define WATCHY_ULP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+//ULP coprocessor program that keeps sensing while the cores sleep. Every ULP_PERIOD_US it counts rising
+//edges of the BMA423 INT1 line, and every ULP_BATTERY_POLLS periods it reads the battery ADC. It wakes the
+//cores (ESP_SLEEP_WAKEUP_ULP) when the edges since it was armed reach the armed count, or when a
+//battery reading is below the armed level. Its code and counters live in the RTC memory the ULP reserves
+class WatchyULP {
+    public:
+        static void start(uint8_t batteryPin); //load the program and start the ULP timer, runs until stop
+        static void stop();
+        static bool running();
+        //before deep sleep: the wake thresholds, 0 turns either off, and the pulse count restarts. The battery
+        //wake is only armed while the last reading is above it, so a low battery wakes the cores once
+        static void arm(uint16_t pulseWake, uint16_t batteryWakeMv);
+        static uint16_t takePulses(); //INT1 edges since arm, the count restarts
+        static uint16_t batteryMillivolts(); //last reading, 0 before the first one
+    private:
+        static uint16_t _rawFromMillivolts(uint16_t mv);
+};
+
+#endif
@@ -0,0 +1,159 @@
+#include "WatchyWakeStub.h"
+#include <esp_sleep.h>
+#include <rom/ets_sys.h>
+#include <soc/rtc.h>
+#include <soc/rtc_cntl_reg.h>
+#include <soc/gpio_reg.h>
+#include <soc/gpio_sig_map.h>
+#include <soc/io_mux_reg.h>
+#include "WatchyRTC.h"
+
+//The stub runs before the flash cache is enabled: its code, data and constants must all be in RTC memory,
+//so it only uses registers, ROM functions and immediates (no tables, no library calls)
+#if SDA != 21 || SCL != 22
+#error "the wake stub selects the GPIO function of the I2C pads by name"
+#endif
+
+#define STUB_I2C_HALF_BIT_US 1 //SCL is low for 2 delays and high for 1, under 400kHz, the fast mode both RTCs support
+
+static RTC_DATA_ATTR uint8_t stubRtcType;
+static RTC_DATA_ATTR uint16_t stubAlarmWakes; //left to handle before the app runs again
+static RTC_DATA_ATTR uint16_t stubHandled;
+static RTC_DATA_ATTR uint8_t stubAlarmMinute; //PCF8563 alarm minute, the one that woke us
+
+//open drain by hand: the output level stays 0 and a line is driven low by enabling the output,
+//released to the pull-up by disabling it
+static void RTC_IRAM_ATTR _stubLine(uint8_t pin, bool high){
+    REG_WRITE(high ? GPIO_ENABLE_W1TC_REG : GPIO_ENABLE_W1TS_REG, 1UL << pin);
+    ets_delay_us(STUB_I2C_HALF_BIT_US);
+}
+
+static bool RTC_IRAM_ATTR _stubSDA(){
+    return (REG_READ(GPIO_IN_REG) >> SDA) & 1;
+}
+
+static void RTC_IRAM_ATTR _stubPins(){
+    REG_WRITE(GPIO_OUT_W1TC_REG, (1UL << SDA) | (1UL << SCL));
+    REG_WRITE(GPIO_ENABLE_W1TC_REG, (1UL << SDA) | (1UL << SCL));
+    REG_WRITE(GPIO_FUNC0_OUT_SEL_CFG_REG + SDA * 4, SIG_GPIO_OUT_IDX);
+    REG_WRITE(GPIO_FUNC0_OUT_SEL_CFG_REG + SCL * 4, SIG_GPIO_OUT_IDX);
+    PIN_FUNC_SELECT(PERIPHS_IO_MUX_GPIO21_U, PIN_FUNC_GPIO);
+    PIN_FUNC_SELECT(PERIPHS_IO_MUX_GPIO22_U, PIN_FUNC_GPIO);
+    PIN_INPUT_ENABLE(PERIPHS_IO_MUX_GPIO21_U);
+    PIN_INPUT_ENABLE(PERIPHS_IO_MUX_GPIO22_U);
+}
+
+static void RTC_IRAM_ATTR _stubStart(){ //also a repeated start, SCL is low between bytes
+    _stubLine(SDA, true);
+    _stubLine(SCL, true);
+    _stubLine(SDA, false);
+    _stubLine(SCL, false);
+}
+
+static void RTC_IRAM_ATTR _stubStop(){
+    _stubLine(SDA, false);
+    _stubLine(SCL, true);
+    _stubLine(SDA, true);
+}
+
+static bool RTC_IRAM_ATTR _stubWrite(uint8_t byte){ //true if acked
+    for(int8_t bit = 7; bit >= 0; bit--){
+        _stubLine(SDA, (byte >> bit) & 1);
+        _stubLine(SCL, true);
+        _stubLine(SCL, false);
+    }
+    _stubLine(SDA, true);
+    _stubLine(SCL, true);
+    bool ack = !_stubSDA();
+    _stubLine(SCL, false);
+    return ack;
+}
+
+static uint8_t RTC_IRAM_ATTR _stubReadLast(){ //one byte, nacked
+    uint8_t byte = 0;
+    _stubLine(SDA, true);
+    for(uint8_t bit = 0; bit < 8; bit++){
+        _stubLine(SCL, true);
+        byte = (byte << 1) | _stubSDA();
+        _stubLine(SCL, false);
+    }
+    _stubLine(SCL, true);
+    _stubLine(SCL, false);
+    return byte;
+}
+
+static bool RTC_IRAM_ATTR _stubReadRegister(uint8_t address, uint8_t reg, uint8_t *value){
+    _stubStart();
+    bool ok = _stubWrite(address << 1) && _stubWrite(reg);
+    if(ok){
+        _stubStart();
+        ok = _stubWrite((address << 1) | 1);
+        if(ok){
+            *value = _stubReadLast();
+        }
+    }
+    _stubStop();
+    return ok;
+}
+
+//register then up to 4 data bytes, first in the low byte, without an array the compiler could put in flash
+static bool RTC_IRAM_ATTR _stubWriteRegisters(uint8_t address, uint8_t reg, uint32_t data, uint8_t len){
+    _stubStart();
+    bool ok = _stubWrite(address << 1) && _stubWrite(reg);
+    for(uint8_t i = 0; ok && i < len; i++){
+        ok = _stubWrite(data >> (8 * i));
+    }
+    _stubStop();
+    return ok;
+}
+
+//same as WatchyRTC::clearAlarm, releases the alarm line so EXT0 doesn't wake us straight back up
+static bool RTC_IRAM_ATTR _stubClearAlarm(){
+    _stubPins();
+    if(stubRtcType == DS3231){
+        uint8_t status;
+        if(!_stubReadRegister(RTC_DS_ADDR, DS_STATUS_REG, &status)){
+            return false;
+        }
+        return _stubWriteRegisters(RTC_DS_ADDR, DS_STATUS_REG, status & ~DS_STATUS_A2F, 1);
+    }
+    //the alarm fired at stubAlarmMinute, so the current minute is known without reading it
+    uint8_t next = (stubAlarmMinute >= 59) ? 0 : (stubAlarmMinute + 1);
+    uint32_t alarm = ((next / 10) << 4 | next % 10) |
+        PCF_ALARM_DISABLE << 8 | PCF_ALARM_DISABLE << 16 | (uint32_t)PCF_ALARM_DISABLE << 24;
+    if(!_stubWriteRegisters(RTC_PCF_ADDR, PCF_ALARM_MINUTE_REG, alarm, 4)){
+        return false;
+    }
+    stubAlarmMinute = next;
+    uint8_t ctrl2;
+    return _stubReadRegister(RTC_PCF_ADDR, PCF_CTRL2_REG, &ctrl2) &&
+        _stubWriteRegisters(RTC_PCF_ADDR, PCF_CTRL2_REG, (ctrl2 & ~PCF_CTRL2_AF) | PCF_CTRL2_AIE, 1);
+}
+
+void RTC_IRAM_ATTR esp_wake_deep_sleep(void){
+    bool alarm = REG_GET_FIELD(RTC_CNTL_WAKEUP_STATE_REG, RTC_CNTL_WAKEUP_CAUSE) & RTC_EXT0_TRIG_EN;
+    if(alarm && stubAlarmWakes > 0 && _stubClearAlarm()){
+        stubAlarmWakes--;
+        stubHandled++;
+        //back to sleep with the wake sources the app armed, through this stub again
+        REG_WRITE(RTC_ENTRY_ADDR_REG, (uint32_t)&esp_wake_deep_sleep);
+        CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_SLEEP_EN);
+        SET_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_SLEEP_EN);
+        while(true){
+            //the sleep takes a few cycles to start
+        }
+    }
+    esp_default_wake_deep_sleep(); //boot the app
+}
+
+void WatchyWakeStub::arm(uint8_t rtcType, uint16_t alarmWakes, uint8_t alarmMinute){
+    stubRtcType = rtcType;
+    stubAlarmWakes = alarmWakes;
+    stubAlarmMinute = alarmMinute;
+}
+
+uint16_t WatchyWakeStub::collect(){
+    uint16_t handled = stubHandled;
+    stubHandled = 0;
+    return handled;
+}
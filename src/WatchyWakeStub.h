@@ -0,0 +1,19 @@
+#ifndef WATCHY_WAKE_STUB_H
+#define WATCHY_WAKE_STUB_H
+
+#include <Arduino.h>
+#include "config.h"
+
+//Deep sleep wake stub: runs from RTC memory straight out of the ROM, before the bootloader loads the app.
+//It handles RTC alarm wakes the app has nothing to do for, clearing the alarm with bit banged I2C
+//at fast mode speed and going back to sleep. The bit delays add up to 368us for the PCF8563's 3 transactions
+//and 199us for the DS3231's 2, plus the GPIO register writes. Any other wake, or an I2C error, boots
+class WatchyWakeStub {
+    public:
+        //before deep sleep: the stub handles the next alarmWakes RTC alarm wakes, the one after boots.
+        //alarmMinute is the PCF8563 alarm just set, the stub moves it on a minute per wake without reading the time
+        static void arm(uint8_t rtcType, uint16_t alarmWakes, uint8_t alarmMinute);
+        static uint16_t collect(); //alarm wakes the stub handled since the app last ran, the count restarts
+};
+
+#endif
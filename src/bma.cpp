@@ -13,6 +13,8 @@ BMA423::BMA423()
     __writeRegisterFptr = nullptr;
     __delayCallBlackFptr = nullptr;
     __init = false;
+    __IRQ_MASK = 0;
+    __stepCount = 0;
 }
 
 BMA423::~BMA423()
@@ -85,12 +87,12 @@ void BMA423::softReset()
 
 void BMA423::shutDown()
 {
-    bma4_set_advance_power_save(BMA4_DISABLE,  &__devFptr);
+    bma4_set_advance_power_save(BMA4_ENABLE,  &__devFptr);
 }
 
 void BMA423::wakeUp()
 {
-    bma4_set_advance_power_save(BMA4_ENABLE, &__devFptr);
+    bma4_set_advance_power_save(BMA4_DISABLE, &__devFptr);
 }
 
 uint16_t BMA423::getErrorCode()
@@ -224,6 +226,7 @@ uint32_t BMA423::getCounter()
 {
     uint32_t stepCount;
     if (bma423_step_counter_output(&stepCount, &__devFptr) == BMA4_OK) {
+        __stepCount = stepCount;
         return stepCount;
     }
     return 0;
@@ -234,11 +237,33 @@ bool BMA423::setINTPinConfig(struct bma4_int_pin_config config, uint8_t pinMap)
     return BMA4_OK == bma4_set_int_pin_config(&config, pinMap, &__devFptr);
 }
 
+bool BMA423::setINTMode(uint8_t mode)
+{
+    return BMA4_OK == bma4_set_interrupt_mode(mode, &__devFptr);
+}
+
 bool BMA423::getINT()
 {
     return bma423_read_int_status(&__IRQ_MASK, &__devFptr) == BMA4_OK;
 }
 
+bool BMA423::update()
+{
+    // INT_STATUS_0/1 (0x1C, 0x1D) are directly followed by the step counter output (0x1E - 0x21)
+    uint8_t data[6];
+    if (bma4_read_regs(BMA4_INT_STAT_0_ADDR, data, sizeof(data), &__devFptr) != BMA4_OK) {
+        return false;
+    }
+    __IRQ_MASK = data[0] | ((uint16_t)data[1] << 8);
+    __stepCount = (uint32_t)data[2] | ((uint32_t)data[3] << 8) | ((uint32_t)data[4] << 16) | ((uint32_t)data[5] << 24);
+    return true;
+}
+
+uint32_t BMA423::getLastCounter()
+{
+    return __stepCount;
+}
+
 uint8_t BMA423::getIRQMASK()
 {
     return __IRQ_MASK;
@@ -292,6 +317,11 @@ bool BMA423::enableStepCountInterrupt(bool en)
     return  (BMA4_OK == bma423_map_interrupt(BMA4_INTR1_MAP,  BMA423_STEP_CNTR_INT, en, &__devFptr));
 }
 
+bool BMA423::setStepCountWatermark(uint16_t level)
+{
+    return  (BMA4_OK == bma423_step_counter_set_watermark(level, &__devFptr));
+}
+
 bool BMA423::enableTiltInterrupt(bool en)
 {
     return  (BMA4_OK == bma423_map_interrupt(BMA4_INTR1_MAP, BMA423_TILT_INT, en, &__devFptr));
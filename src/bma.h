@@ -45,7 +45,9 @@ public:
     bool enableAccel(bool en = true);
 
     bool setINTPinConfig(struct bma4_int_pin_config config, uint8_t pinMap);
+    bool setINTMode(uint8_t mode); //BMA4_LATCH_MODE or BMA4_NON_LATCH_MODE
     bool getINT();
+    bool update(); //interrupt status and step counter in one burst read
     uint8_t getIRQMASK();
     bool disableIRQ(uint16_t int_map = BMA423_STEP_CNTR_INT);
     bool enableIRQ(uint16_t int_map = BMA423_STEP_CNTR_INT);
@@ -57,6 +59,7 @@ public:
 
     bool resetStepCounter();
     uint32_t getCounter();
+    uint32_t getLastCounter(); //step count from the last update(), no bus access
 
     float readTemperature();
     float readTemperatureF();
@@ -71,6 +74,7 @@ public:
 
     bool enableFeature(uint8_t feature, uint8_t enable );
     bool enableStepCountInterrupt(bool en = true);
+    bool setStepCountWatermark(uint16_t level); //the step counter interrupt fires every level * 20 steps
     bool enableTiltInterrupt(bool en = true);
     bool enableWakeupInterrupt(bool en = true);
     bool enableAnyNoMotionInterrupt(bool en = true);
@@ -83,6 +87,7 @@ private:
 
     uint8_t __address;
     uint16_t __IRQ_MASK;
+    uint32_t __stepCount;
     bool __init;
     struct bma4_dev __devFptr;
 };
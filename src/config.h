@@ -16,15 +16,54 @@
 #define BACK_BTN_PIN 25
 #define UP_BTN_PIN 32
 #define DOWN_BTN_PIN 4
+#define ACC_INT_1_PIN 14
 #define MENU_BTN_MASK GPIO_SEL_26
 #define BACK_BTN_MASK GPIO_SEL_25
 #define UP_BTN_MASK GPIO_SEL_32
 #define DOWN_BTN_MASK GPIO_SEL_4
 #define ACC_INT_MASK GPIO_SEL_14
-#define BTN_PIN_MASK MENU_BTN_MASK|BACK_BTN_MASK|UP_BTN_MASK|DOWN_BTN_MASK
+#define BTN_PIN_MASK (MENU_BTN_MASK|BACK_BTN_MASK|UP_BTN_MASK|DOWN_BTN_MASK)
+//i2c
+#define I2C_CLOCK_HZ 400000 //DS3231, PCF8563 and BMA423 all support fast mode
+#define I2C_RECOVERY_CLOCKS 9 //enough to finish any byte a stuck slave is sending
+//accelerometer power profiles
+#define ACCEL_PROFILE_ULTRA_LOW 0 //accel off, no features
+#define ACCEL_PROFILE_STEP_ONLY 1 //50Hz duty cycled, step counter only
+#define ACCEL_PROFILE_INTERACTIVE 2 //100Hz duty cycled, step counter, tilt and double tap
+#define ACCEL_PROFILE_HIGH_RATE 3 //200Hz continuous sampling for live accel readout
+#define ACCEL_PROFILE_DEFAULT ACCEL_PROFILE_STEP_ONLY
+//wake dispatch
+#define WAKE_EVENT_RESET 0x01 //power on or reset
+#define WAKE_EVENT_ALARM 0x02 //RTC alarm on EXT0, every minute
+#define WAKE_EVENT_BUTTON 0x04 //a button on EXT1
+#define WAKE_EVENT_GESTURE 0x08 //BMA423 INT1 on EXT1, with gesture wake on
+#define WAKE_EVENT_TIMER 0x10 //a timer wakeup armed before deepSleep
+#define WAKE_EVENT_SENSOR 0x20 //the ULP saw enough INT1 pulses or a low battery, see WatchyULP
+#define WAKE_NEEDS_I2C 0x01
+#define WAKE_NEEDS_RTC 0x02 //RTC type probed, implies WAKE_NEEDS_I2C
+#define WAKE_NEEDS_DISPLAY 0x04 //panel initialized or resumed, glyphs cached
+#define WAKE_EXTRA_HANDLERS 4 //handlers faces can add with addWakeHandler
+//ULP background sensing
+#define ULP_PERIOD_US 10000 //INT1 poll period, a shorter pulse can be missed
+#define ULP_BATTERY_POLLS 6000 //periods between battery readings, one a minute
+#define BATTERY_DIVIDER 2 //the battery goes through a 1/2 divider to the ADC
+//cpu frequency, 80MHz and up keep the APB (SPI and I2C clocks) at 80MHz
+#define CPU_IO_MHZ 80 //while awake, the wake is mostly waiting on I2C, SPI and the panel
+#define CPU_DRAW_MHZ 240 //while the face draws
+//energy model of the profiler, typical ESP32 figures with the radio off
+#define ENERGY_ACTIVE_BASE_UA 15000
+#define ENERGY_ACTIVE_UA_PER_MHZ 105 //about 23mA at 80MHz, 40mA at 240MHz
+#define ENERGY_LIGHT_SLEEP_UA 800
+#define ENERGY_SUPPLY_MV 3300
 //display
 #define DISPLAY_WIDTH 200
 #define DISPLAY_HEIGHT 200
+#define DISPLAY_SPI_CLOCK_HZ 20000000 //SSD1681 write cycle is 50ns, GxEPD2 defaults to 4MHz
+#define BACKGROUND_CACHE_SIZE 1536 //RTC memory for the PackBits compressed watch face background, larger ones are redrawn every wake
+#define FRAME_RETAIN_SIZE 3072 //RTC memory for the PackBits compressed frame on the panel, partial refreshes push only what changed. 0 turns it off
+#define REFRESH_REGION_SIZE 40 //partial refreshes are counted per square region of the panel
+#define GHOSTING_BUDGET 120 //partial refreshes of one region before the next refresh is a full one
+#define FULL_REFRESH_HOUR 3 //the first watch face tick at or after this hour each day is a full refresh
 //weather api
 //wifi
 #define WIFI_AP_TIMEOUT 60
@@ -36,9 +75,11 @@
 #define APP_STATE 1
 #define FW_UPDATE_STATE 2
 #define MENU_HEIGHT 30
-#define MENU_LENGTH 12
 #define MENU_PAGE_LENGTH 6
-#define MENU_PAGES (MENU_LENGTH / MENU_PAGE_LENGTH)
+#define MENU_EXTRA_ITEMS 4 //items faces can add with addMenuItem
+#define MENU_ICON_SIZE 16
+//apps
+#define APP_BUTTON_REPEAT_MS 300 //a button held in an app is delivered again after this
 //set time
 #define SET_HOUR 0
 #define SET_MINUTE 1
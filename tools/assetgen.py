@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Generate a watch face's bitmap header from its assets.json manifest.
+
+  tools/assetgen.py examples/WatchFaces/7_SEG        regenerate one face
+  tools/assetgen.py --all                            regenerate every face with a manifest
+  tools/assetgen.py --all --check                    fail if a header is stale (for CI)
+
+A manifest lists the sources (BMP or PNG, paths relative to the manifest) and
+how each one is stored:
+
+  {
+    "header": "icons.h",
+    "assets": [
+      {"name": "steps", "source": "../../../extras/steps.bmp", "invert": true},
+      {"name": "tetrisbg_rle", "source": "bg.bmp", "encoding": "rle"},
+      {"name": "battery", "source": "battery.bmp", "dark": true},
+      {"name": "digits", "encoding": "font", "first": "0",
+       "glyphs": ["0.bmp", "1.bmp"], "advance": 50}
+    ]
+  }
+
+Encodings:
+  raw   Adafruit drawBitmap layout, the fastest to draw at any position
+  rle   PackBits for drawBitmapRLE, smallest for large mostly flat images;
+        decodes straight into the frame buffer when drawn byte aligned
+  auto  rle when it saves at least a quarter of the flash, raw otherwise
+  font  glyph atlas, emitted as a GFXfont so it is drawn with print() and
+        picked up by WatchyDisplay::cacheGlyphs
+"invert" flips the source (dark pixels are set bits by default), "dark" also
+emits a pre-inverted <name>_dark copy for dark mode.
+"""
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import imgconv  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+RLE_MIN_SAVING = 0.25
+
+
+def encode_bitmap(name, w, h, data, encoding):
+    """Returns (header text, flash bytes, encoding used)."""
+    if encoding == 'auto':
+        packed = imgconv.packbits(data)
+        encoding = 'rle' if len(packed) <= len(data) * (1 - RLE_MIN_SAVING) else 'raw'
+    if encoding == 'rle':
+        data = imgconv.packbits(data)
+        return imgconv.c_array(name, data, w, h, 'PackBits'), len(data), encoding
+    return imgconv.c_array(name, data, w, h, 'raw'), len(data), encoding
+
+
+def encode_font(name, asset, base, threshold):
+    """Pack a list of images into a GFXfont: one bit stream without row padding, baseline under each glyph."""
+    first = ord(asset.get('first', '0'))
+    bits = []
+    glyphs = []
+    y_advance = 0
+    for path in asset['glyphs']:
+        w, h, data = imgconv.read_image(os.path.join(base, path), threshold)
+        if asset.get('invert'):
+            data = imgconv.invert(data, w)
+        stride = (w + 7) // 8
+        offset = len(bits) // 8
+        for y in range(h):
+            for x in range(w):
+                bits.append((data[y * stride + (x >> 3)] >> (7 - (x & 7))) & 1)
+        bits += [0] * (-len(bits) % 8)
+        glyphs.append((offset, w, h, asset.get('advance', w), 0, -h))
+        y_advance = max(y_advance, h)
+    bitmap = bytes(sum(bit << (7 - i) for i, bit in enumerate(bits[b:b + 8])) for b in range(0, len(bits), 8))
+    lines = ["// '%s', %d glyphs from '%s', GFXfont" % (name, len(glyphs), chr(first))]
+    lines.append('const uint8_t %sBitmaps[] PROGMEM = {' % name)
+    for i in range(0, len(bitmap), 16):
+        lines.append('\t' + ', '.join('0x%02x' % b for b in bitmap[i:i + 16]) + (',' if i + 16 < len(bitmap) else ''))
+    lines.append('};')
+    lines.append('const GFXglyph %sGlyphs[] PROGMEM = {' % name)
+    for i, glyph in enumerate(glyphs):
+        lines.append('\t{ %5d, %3d, %3d, %3d, %4d, %4d }%s // %r' % (glyph + (',' if i + 1 < len(glyphs) else '', chr(first + i))))
+    lines.append('};')
+    lines.append('const GFXfont %s PROGMEM = {(uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, 0x%02x, 0x%02x, %d};'
+                 % (name, name, name, first, first + len(glyphs) - 1, y_advance))
+    size = len(bitmap) + 7 * len(glyphs) + 16
+    return '\n'.join(lines) + '\n', size
+
+
+def generate(face_dir, threshold):
+    """Returns (header path, header text, report rows)."""
+    manifest_path = os.path.join(face_dir, 'assets.json')
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+    base = os.path.dirname(manifest_path)
+    parts = []
+    report = []
+    for asset in manifest['assets']:
+        name = asset['name']
+        encoding = asset.get('encoding', 'raw')
+        if encoding == 'font':
+            text, size = encode_font(name, asset, base, threshold)
+            parts.append(text)
+            report.append((name, '%d glyphs' % len(asset['glyphs']), '-', size, 'font'))
+            continue
+        w, h, data = imgconv.read_image(os.path.join(base, asset['source']), threshold)
+        if asset.get('invert'):
+            data = imgconv.invert(data, w)
+        text, size, used = encode_bitmap(name, w, h, data, encoding)
+        parts.append(text)
+        report.append((name, '%dx%d' % (w, h), len(data), size, used))
+        if asset.get('dark'):
+            dark = imgconv.invert(data, w)
+            text, size, used = encode_bitmap(name + '_dark', w, h, dark, encoding)
+            parts.append(text)
+            report.append((name + '_dark', '%dx%d' % (w, h), len(dark), size, used))
+    total = sum(row[3] for row in report)
+    header = '// Generated by tools/assetgen.py from assets.json, do not edit. %d bytes of PROGMEM\n' % total
+    return os.path.join(base, manifest['header']), header + ''.join(parts), report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('faces', nargs='*', help='watch face directories containing an assets.json')
+    parser.add_argument('--all', action='store_true', help='every face under examples/ with an assets.json')
+    parser.add_argument('--check', action='store_true', help='only report stale headers, exit 1 if any')
+    parser.add_argument('--threshold', type=int, default=128, help='luma below this is a set bit')
+    args = parser.parse_args()
+
+    faces = list(args.faces)
+    if args.all:
+        faces += sorted(os.path.dirname(p) for p in glob.glob(os.path.join(ROOT, 'examples', '**', 'assets.json'), recursive=True))
+    if not faces:
+        parser.error('no faces given')
+
+    stale = []
+    grand_total = 0
+    for face in faces:
+        path, text, report = generate(face, args.threshold)
+        face_total = sum(row[3] for row in report)
+        grand_total += face_total
+        print('%s (%s)' % (os.path.relpath(face, ROOT), os.path.basename(path)))
+        for name, size, raw, flash, encoding in report:
+            print('  %-20s %-10s %6s raw %6d flash  %s' % (name, size, raw, flash, encoding))
+        print('  %-20s %-10s %6s     %6d flash' % ('total', '', '', face_total))
+        current = open(path).read() if os.path.exists(path) else None
+        if current != text:
+            stale.append(path)
+            if not args.check:
+                with open(path, 'w') as f:
+                    f.write(text)
+    print('all faces: %d bytes of PROGMEM' % grand_total)
+    if args.check and stale:
+        for path in stale:
+            print('stale: %s' % os.path.relpath(path, ROOT), file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""Convert images into Watchy PROGMEM bitmap arrays.
+For whole faces use tools/assetgen.py, which drives this from a manifest.
+
+Bitmaps use the Adafruit_GFX drawBitmap layout: 1bpp, rows padded to whole
+bytes, MSB is the leftmost pixel, a set bit is drawn in the foreground color.
+With --rle the bytes are PackBits compressed for WatchyDisplay::drawBitmapRLE.
+
+  tools/imgconv.py extras/steps.bmp --name steps
+  tools/imgconv.py extras/steps.bmp --name steps --rle
+  tools/imgconv.py --from-header examples/WatchFaces/Tetris/tetris.h \
+      --array tetrisbg --size 200x200 --name tetrisbg_rle --rle
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+
+def read_bmp(path, threshold=128):
+    """Read an uncompressed 1/8/24/32bpp BMP, returns (w, h, packed rows).
+    Dark pixels become set bits."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:2] != b'BM':
+        raise ValueError('%s: not a BMP file' % path)
+    offset = struct.unpack_from('<I', data, 10)[0]
+    header_size = struct.unpack_from('<I', data, 14)[0]
+    w, h = struct.unpack_from('<ii', data, 18)
+    bpp = struct.unpack_from('<H', data, 28)[0]
+    compression = struct.unpack_from('<I', data, 30)[0]
+    if compression not in (0, 3) or bpp not in (1, 8, 24, 32):
+        raise ValueError('%s: unsupported BMP (%dbpp, compression %d)' % (path, bpp, compression))
+    palette = []
+    if bpp <= 8:
+        colors = struct.unpack_from('<I', data, 46)[0] or (1 << bpp)
+        base = 14 + header_size
+        for i in range(colors):
+            b, g, r = data[base + 4 * i:base + 4 * i + 3]
+            palette.append((r, g, b))
+    bottom_up = h > 0
+    h = abs(h)
+    row_size = ((w * bpp + 31) // 32) * 4
+    pixels = []
+    for y in range(h):
+        src_y = h - 1 - y if bottom_up else y
+        row = data[offset + src_y * row_size:offset + (src_y + 1) * row_size]
+        line = []
+        for x in range(w):
+            if bpp == 1:
+                rgb = palette[(row[x >> 3] >> (7 - (x & 7))) & 1]
+            elif bpp == 8:
+                rgb = palette[row[x]]
+            else:
+                step = bpp // 8
+                b, g, r = row[x * step:x * step + 3]
+                rgb = (r, g, b)
+            luma = (rgb[0] * 299 + rgb[1] * 587 + rgb[2] * 114) // 1000
+            line.append(luma < threshold)
+        pixels.append(line)
+    return w, h, pack(pixels, w)
+
+
+def read_png(path, threshold=128):
+    """Read a non-interlaced PNG (any color type, 8bpp or less), returns (w, h, packed rows).
+    Dark or transparent pixels become set bits."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+    pos = 8
+    idat = b''
+    palette = []
+    trns = b''
+    while pos < len(data):
+        length, kind = struct.unpack_from('>I4s', data, pos)
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            w, h, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+    if depth > 8 or interlace:
+        raise ValueError('%s: unsupported PNG (%d bit, interlace %d)' % (path, depth, interlace))
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    bpp = max(1, channels * depth // 8)
+    row_size = (w * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+    prev = bytearray(row_size)
+    pixels = []
+    for y in range(h):
+        filter_type = raw[y * (row_size + 1)]
+        row = bytearray(raw[y * (row_size + 1) + 1:(y + 1) * (row_size + 1)])
+        for i in range(row_size):
+            a = row[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if filter_type == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif filter_type == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif filter_type == 3:
+                row[i] = (row[i] + (a + b) // 2) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                row[i] = (row[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = row
+        line = []
+        for x in range(w):
+            if depth < 8:
+                samples = [(row[x * depth >> 3] >> (8 - depth - (x * depth & 7))) & ((1 << depth) - 1)]
+            else:
+                samples = list(row[x * channels:(x + 1) * channels])
+            alpha = 255
+            if color_type == 3:
+                index = samples[0]
+                rgb = palette[index]
+                alpha = trns[index] if index < len(trns) else 255
+            elif color_type in (0, 4):
+                v = samples[0] * 255 // ((1 << depth) - 1)
+                rgb = (v, v, v)
+                alpha = samples[1] if color_type == 4 else 255
+            else:
+                rgb = tuple(samples[:3])
+                alpha = samples[3] if color_type == 6 else 255
+            luma = (rgb[0] * 299 + rgb[1] * 587 + rgb[2] * 114) // 1000
+            line.append(alpha < 128 or luma < threshold)
+        pixels.append(line)
+    return w, h, pack(pixels, w)
+
+
+def read_image(path, threshold=128):
+    if path.lower().endswith('.png'):
+        return read_png(path, threshold)
+    return read_bmp(path, threshold)
+
+
+def write_bmp(path, w, h, data):
+    """Write a packed bitmap as a 1bpp BMP, set bits are black."""
+    stride = (w + 7) // 8
+    row_size = ((w + 31) // 32) * 4
+    rows = b''
+    for y in range(h - 1, -1, -1):
+        row = bytes(b ^ 0xFF for b in data[y * stride:(y + 1) * stride])
+        rows += row + bytes(row_size - stride)
+    header = struct.pack('<IiiHHIIiiII', 40, w, h, 1, 1, 0, len(rows), 2835, 2835, 2, 2)
+    palette = bytes([0, 0, 0, 0, 255, 255, 255, 0])
+    offset = 14 + len(header) + len(palette)
+    with open(path, 'wb') as f:
+        f.write(b'BM' + struct.pack('<IHHI', offset + len(rows), 0, 0, offset))
+        f.write(header + palette + rows)
+
+
+def pack(pixels, w):
+    stride = (w + 7) // 8
+    out = bytearray()
+    for line in pixels:
+        row = bytearray(stride)
+        for x, on in enumerate(line):
+            if on:
+                row[x >> 3] |= 0x80 >> (x & 7)
+        out += row
+    return bytes(out)
+
+
+def read_c_array(path, name):
+    """Pull the bytes of `const unsigned char name [] PROGMEM = {...}` out of a header."""
+    with open(path) as f:
+        text = f.read()
+    match = re.search(r'\b%s\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\}' % re.escape(name), text, re.S)
+    if match is None:
+        raise ValueError('%s: no array named %s' % (path, name))
+    return bytes(int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\b\d+\b', match.group(1)))
+
+
+def invert(data, w):
+    """Flip every pixel, keeping the row padding bits clear."""
+    stride = (w + 7) // 8
+    pad = (0xFF << ((8 - (w & 7)) & 7)) & 0xFF
+    out = bytearray(b ^ 0xFF for b in data)
+    for i in range(stride - 1, len(out), stride):
+        out[i] &= pad
+    return bytes(out)
+
+
+def packbits(data):
+    """PackBits: n in 0..127 copies n+1 literal bytes, n in -127..-1 repeats the next byte 1-n times."""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3 or (run == 2 and not literal):
+            if literal:
+                out.append(len(literal) - 1)
+                out += literal
+                literal = bytearray()
+            out.append((1 - run) & 0xFF)
+            out.append(data[i])
+            i += run
+        else:
+            literal += data[i:i + run]
+            i += run
+            while len(literal) >= 128:
+                out.append(127)
+                out += literal[:128]
+                literal = literal[128:]
+    if literal:
+        out.append(len(literal) - 1)
+        out += literal
+    return bytes(out)
+
+
+def unpackbits(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    return bytes(out)
+
+
+def c_array(name, data, w, h, encoding):
+    lines = ["// '%s', %dx%dpx%s" % (name, w, h, ', ' + encoding if encoding != 'raw' else '')]
+    lines.append('const unsigned char %s [] PROGMEM = {' % name)
+    for i in range(0, len(data), 16):
+        chunk = ', '.join('0x%02x' % b for b in data[i:i + 16])
+        lines.append('\t' + chunk + (',' if i + 16 < len(data) else ''))
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('image', nargs='?', help='BMP or PNG source image')
+    parser.add_argument('--from-header', help='re-encode an existing array from this header instead')
+    parser.add_argument('--array', help='array name to read with --from-header')
+    parser.add_argument('--size', help='WxH of the array read with --from-header')
+    parser.add_argument('--name', required=True, help='name of the generated array')
+    parser.add_argument('--rle', action='store_true', help='PackBits compress the bitmap')
+    parser.add_argument('--invert', action='store_true', help='flip every pixel (e.g. for dark mode)')
+    parser.add_argument('--threshold', type=int, default=128, help='luma below this is a set bit')
+    parser.add_argument('--export-bmp', help='also write the (inverted) bitmap back out as a BMP source')
+    parser.add_argument('-o', '--output', help='write here instead of stdout')
+    args = parser.parse_args()
+
+    if args.from_header:
+        if not args.array or not args.size:
+            parser.error('--from-header needs --array and --size')
+        w, h = (int(v) for v in args.size.lower().split('x'))
+        data = read_c_array(args.from_header, args.array)
+        if len(data) != ((w + 7) // 8) * h:
+            parser.error('%s is %d bytes, not %s' % (args.array, len(data), args.size))
+    elif args.image:
+        w, h, data = read_image(args.image, args.threshold)
+    else:
+        parser.error('no image given')
+
+    if args.invert:
+        data = invert(data, w)
+    if args.export_bmp:
+        write_bmp(args.export_bmp, w, h, data)
+    encoding = 'raw'
+    raw_size = len(data)
+    if args.rle:
+        encoded = packbits(data)
+        assert unpackbits(encoded, raw_size) == data
+        data = encoded
+        encoding = 'PackBits'
+    sys.stderr.write('%s: %dx%d, %d bytes raw, %d bytes %s\n' % (args.name, w, h, raw_size, len(data), encoding))
+
+    text = c_array(args.name, data, w, h, encoding)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
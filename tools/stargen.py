@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Generate the StarryHorizon star field header, binned for visibility culling.
+
+  tools/stargen.py > examples/WatchFaces/StarryHorizon/stars.h
+
+The field is the one the face's old initStars() printed on the watch: srand(5287)
+and newlib's rand(), 900 stars. Stars are rotated around (100, 100) by one
+6 degree step per minute, so they are sorted into polar bins of one step
+(sector) by RING_EDGES (ring). Rotating by m minutes moves sector k to
+screen sector k - m, and STAR_VISIBLE_SECTORS holds, per ring, the screen
+sectors that can reach the visible sky. The face only walks the bins that land
+there.
+
+Stars that are off screen at every angle are dropped. Each remaining star is an
+int16: 7 bit x and y offsets from its bin's anchor and a 2 bit radius. A bin is
+its star count and an anchor stored as int8 steps of 2 px from the center, the
+face sums the counts as it walks the bins in order.
+"""
+
+import argparse
+import math
+import sys
+
+SEED = 5287
+STAR_COUNT = 900
+CENTER = 100
+HORIZON_Y = 150
+SECTORS = 60
+RING_EDGES = (0, 53, 76, 100, 124, 146)  # the inner ring is above the horizon at any angle
+RINGS = len(RING_EDGES) - 1
+SLACK = 2  # px around the visible area, covers rounding of the rotated positions
+
+
+def newlib_rand(seed):
+    state = seed
+    while True:
+        state = (state * 6364136223846793005 + 1) & 0xFFFFFFFFFFFFFFFF
+        yield (state >> 32) & 0x7FFFFFFF
+
+
+def star_field():
+    rand = newlib_rand(SEED)
+    stars = []
+    for i in range(STAR_COUNT):
+        x = next(rand) % 260 - 30
+        y = next(rand) % 260 - 30
+        r = 0
+        if i > STAR_COUNT * 0.99:
+            r = 2
+        elif i > STAR_COUNT * 0.80:
+            r = 1
+        stars.append((x, y, r))
+    return stars
+
+
+def visible(x, y):
+    return -SLACK <= x <= 200 + SLACK and -SLACK <= y <= HORIZON_Y + SLACK
+
+
+def bin_of(x, y):
+    dx, dy = x - CENTER, y - CENTER
+    dist = math.hypot(dx, dy)
+    ring = max(i for i in range(RINGS) if RING_EDGES[i] <= dist)
+    sector = int(math.floor(math.degrees(math.atan2(dy, dx)) / (360 / SECTORS))) % SECTORS
+    return ring, sector
+
+
+def sector_visible(ring, sector):
+    """Does any point of the annular sector fall in the visible sky (screen frame)."""
+    r0, r1 = RING_EDGES[ring], RING_EDGES[ring + 1]
+    a0 = math.radians(sector * 360 / SECTORS)
+    a1 = math.radians((sector + 1) * 360 / SECTORS)
+    for i in range(65):
+        a = a0 + (a1 - a0) * i / 64
+        for j in range(4 * (r1 - r0) + 1):
+            r = r0 + j / 4
+            if visible(CENTER + r * math.cos(a), CENTER + r * math.sin(a)):
+                return True
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.parse_args()
+
+    reach = math.hypot(CENTER + SLACK, CENTER + SLACK)
+    bins = [[] for _ in range(RINGS * SECTORS)]
+    dropped = 0
+    for x, y, r in star_field():
+        if math.hypot(x - CENTER, y - CENTER) > reach:
+            dropped += 1
+            continue
+        ring, sector = bin_of(x, y)
+        assert math.hypot(x - CENTER, y - CENTER) < RING_EDGES[-1]
+        bins[ring * SECTORS + sector].append((x, y, r))
+
+    anchors = []
+    counts = []
+    packed = []
+    for stars in bins:
+        # anchor rounded down to an even offset from the center so it fits an int8
+        ax = (min((s[0] for s in stars), default=CENTER) - CENTER) // 2
+        ay = (min((s[1] for s in stars), default=CENTER) - CENTER) // 2
+        assert -128 <= ax < 128 and -128 <= ay < 128 and len(stars) < 256
+        anchors.append((ax, ay))
+        counts.append(len(stars))
+        for x, y, r in stars:
+            dx, dy = x - (CENTER + 2 * ax), y - (CENTER + 2 * ay)
+            assert 0 <= dx < 128 and 0 <= dy < 128 and r < 4
+            packed.append(dx << 9 | dy << 2 | r)
+    masks = []
+    for ring in range(RINGS):
+        mask = 0
+        for sector in range(SECTORS):
+            if sector_visible(ring, sector):
+                mask |= 1 << sector
+        masks.append(mask)
+
+    out = sys.stdout
+    flash = 2 * len(packed) + 3 * len(bins) + 8 * RINGS
+    out.write('// Generated by tools/stargen.py, do not edit. %d of %d stars, %d bytes of PROGMEM\n'
+              % (len(packed), STAR_COUNT, flash))
+    out.write('// stars off screen at every angle are dropped, the rest are sorted into polar bins around (%d, %d)\n\n'
+              % (CENTER, CENTER))
+    out.write('#define STAR_SECTORS %d //one per minute\n' % SECTORS)
+    out.write('#define STAR_RINGS %d\n' % RINGS)
+    out.write('#define STAR_BIN_COUNT (STAR_SECTORS * STAR_RINGS)\n')
+    out.write('#define STAR_CENTER %d\n\n' % CENTER)
+    out.write('struct StarBin {\n  uint8_t count;\n  int8_t x; //anchor, in steps of 2px from STAR_CENTER\n  int8_t y;\n};\n\n')
+    out.write('// bit s is set if a star of that ring rotated into screen sector s can be above the horizon\n')
+    out.write('const uint64_t STAR_VISIBLE_SECTORS[STAR_RINGS] PROGMEM = {\n')
+    for mask in masks:
+        out.write('  0x%015xULL,\n' % mask)
+    out.write('};\n\n')
+    out.write('// bin ring * STAR_SECTORS + sector, its stars follow those of the previous bins in STARS\n')
+    out.write('const StarBin STAR_BINS[STAR_BIN_COUNT] PROGMEM = {\n')
+    for i in range(0, len(bins), 6):
+        out.write('  ' + ' '.join('{ %d, %d, %d },' % (c, a[0], a[1]) for c, a in zip(counts[i:i + 6], anchors[i:i + 6])) + '\n')
+    out.write('};\n\n')
+    out.write('// x offset << 9 | y offset << 2 | radius, offsets from the anchor of the bin\n')
+    out.write('const uint16_t STARS[] PROGMEM = {\n')
+    for i in range(0, len(packed), 10):
+        out.write('  ' + ' '.join('0x%04x,' % p for p in packed[i:i + 10]) + '\n')
+    out.write('};\n')
+    walked = 0
+    for minute in range(SECTORS):
+        for b, stars in enumerate(bins):
+            if masks[b // SECTORS] >> ((b % SECTORS - minute) % SECTORS) & 1:
+                walked += len(stars)
+    sys.stderr.write('%d stars kept, %d dropped, %d bytes, %.0f stars walked per minute on average\n'
+                     % (len(packed), dropped, flash, walked / SECTORS))
+
+
+if __name__ == '__main__':
+    main()